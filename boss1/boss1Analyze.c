@@ -0,0 +1,270 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+#include "boss1Core.h"
+#include "boss1Sim.h"
+#include "boss1Duct.h"
+#include "boss1Log.h"
+
+// Offline analysis of a game log with root-parallel DUCT on every core.
+//
+//   gcc -O2 -pthread -o boss1Analyze boss1Analyze.c -lm
+//   ./boss1Analyze game.b1log [-t threads] [-m ms_per_turn] [-f first] [-l last]
+//
+// For each turn every thread searches the logged position with its own tree and seed,
+// then adds its root statistics to a shared table through atomic operations only: a
+// CAS claims a move's slot, fetch-adds merge visits and rewards. The merged root gives
+// one line per turn:
+//
+//   turn 12  best GROW 7 5 3 BASIC N  0.634 (41200)  played GROW 7 4 2 BASIC N  0.571 (8100)  -0.063 ?
+//
+// with the best move's value for us and its visits, the move the bot played with the
+// same, and their difference. '?' flags a played move ANALYZE_BLUNDER below the best,
+// '!' one the search never considered. Each thread holds a full node pool (~35 MB).
+
+#define ANALYZE_MAX_THREADS 64
+#define ANALYZE_TABLE_SIZE 1024       // power of two, well above the moves at a root
+#define ANALYZE_EMPTY UINT32_MAX      // MOVE_WAIT is 0, so a free slot needs another mark
+#define ANALYZE_REWARD_SCALE 1e6      // rewards are summed as fixed point so they can be fetch-added
+#define ANALYZE_BLUNDER 0.05
+#define ANALYZE_DEFAULT_MS 2000.0
+
+typedef struct {
+    _Atomic uint32_t move;
+    _Atomic uint64_t visits;
+    _Atomic uint64_t reward;
+} AnalyzeSlot;
+
+typedef struct {
+    AnalyzeSlot slot[2][ANALYZE_TABLE_SIZE];  // per owner, as in DuctNode
+    _Atomic long iterations;
+} AnalyzeRoot;
+
+typedef struct {
+    Duct duct;
+    const SimState *state;
+    AnalyzeRoot *root;
+    double budget_ms;
+} AnalyzeWorker;
+
+/* #############  SHARED ROOT ################################################ */
+
+static void analyze_root_clear(AnalyzeRoot *root) {
+    for (int o = 0; o < 2; o++) {
+        for (int i = 0; i < ANALYZE_TABLE_SIZE; i++) {
+            atomic_store(&root->slot[o][i].move, ANALYZE_EMPTY);
+            atomic_store(&root->slot[o][i].visits, 0);
+            atomic_store(&root->slot[o][i].reward, 0);
+        }
+    }
+    atomic_store(&root->iterations, 0);
+}
+
+// Function to find or claim the slot of a move; NULL only if the table is full
+static AnalyzeSlot *analyze_slot(AnalyzeRoot *root, int owner, uint32_t move) {
+    uint32_t h = (move * 0x9E3779B1u) >> 22; // 10 bits for ANALYZE_TABLE_SIZE
+    for (int probe = 0; probe < ANALYZE_TABLE_SIZE; probe++) {
+        AnalyzeSlot *slot = &root->slot[owner][(h + probe) & (ANALYZE_TABLE_SIZE - 1)];
+        uint32_t seen = atomic_load(&slot->move);
+        if (seen == ANALYZE_EMPTY) {
+            uint32_t expected = ANALYZE_EMPTY;
+            if (atomic_compare_exchange_strong(&slot->move, &expected, move)) {
+                return slot;
+            }
+            seen = expected; // another thread claimed it first
+        }
+        if (seen == move) {
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+// Function to add one thread's root statistics to the shared root
+static void analyze_publish(AnalyzeRoot *root, const Duct *d) {
+    const DuctNode *node = &d->pool[d->root];
+    for (int o = 0; o < 2; o++) {
+        for (int a = 0; a < node->action_count[o]; a++) {
+            AnalyzeSlot *slot = analyze_slot(root, o, node->actions[o][a]);
+            if (slot != NULL) {
+                atomic_fetch_add(&slot->visits, node->action_visits[o][a]);
+                atomic_fetch_add(&slot->reward, (uint64_t)(node->action_reward[o][a] * ANALYZE_REWARD_SCALE));
+            }
+        }
+    }
+    atomic_fetch_add(&root->iterations, d->iterations);
+}
+
+// Function to pick the most visited move of owner from the merged root
+static const AnalyzeSlot *analyze_best(const AnalyzeRoot *root, int owner) {
+    const AnalyzeSlot *best = NULL;
+    for (int i = 0; i < ANALYZE_TABLE_SIZE; i++) {
+        const AnalyzeSlot *slot = &root->slot[owner][i];
+        if (atomic_load(&slot->move) != ANALYZE_EMPTY && (best == NULL || slot->visits > best->visits)) {
+            best = slot;
+        }
+    }
+    return best;
+}
+
+static double analyze_value(const AnalyzeSlot *slot) {
+    return slot->visits ? (double)slot->reward / ANALYZE_REWARD_SCALE / (double)slot->visits : 0.0;
+}
+
+static void *analyze_worker(void *arg) {
+    AnalyzeWorker *w = arg;
+    duct_search(&w->duct, w->state, w->budget_ms);
+    analyze_publish(w->root, &w->duct);
+    return NULL;
+}
+
+/* ################################################################################# */
+
+/* #############  ACTIONS #################################################### */
+
+// Function to parse a logged action line ("GROW id x y TYPE [dir]" or "WAIT") into a
+// simulator move; returns false for anything the simulator does not model
+static bool analyze_parse_move(const SimState *s, const char *line, uint32_t *move) {
+    int id, x, y;
+    char type[16], dir[4] = "N";
+    if (strncmp(line, "WAIT", 4) == 0) {
+        *move = MOVE_WAIT;
+        return true;
+    }
+    if (sscanf(line, "GROW %d %d %d %15s %3s", &id, &x, &y, type, dir) < 4) {
+        return false;
+    }
+    int from = -1;
+    for (int idx = 0; idx < GRID_CELLS && from < 0; idx++) {
+        if (piece_is_organ(s->grid.piece[idx]) && s->grid.organ_id[idx] == id) {
+            from = idx;
+        }
+    }
+    const char *d = memchr(dir_chars, dir[0], sizeof(dir_chars));
+    for (int t = 0; t < ORGAN_TYPES; t++) {
+        if (from >= 0 && d != NULL && strcmp(type, organ_names[t]) == 0) {
+            // BASIC has no facing in the simulator's move list
+            *move = move_encode(from, grid_index(x, y), t, t == ORGAN_BASIC ? 0 : (int)(d - dir_chars));
+            return true;
+        }
+    }
+    return false;
+}
+
+// Function to print a simulator move padded to a column
+static void analyze_print_move(const SimState *s, uint32_t move) {
+    if (move == MOVE_WAIT) {
+        printf("%-24s", "WAIT");
+        return;
+    }
+    int to = move_to(move);
+    char text[64];
+    snprintf(text, sizeof(text), "GROW %d %d %d %s %c", s->grid.organ_id[move_from(move)], grid_x(to), grid_y(to),
+             organ_names[move_type(move)], dir_chars[move_dir(move)]);
+    printf("%-24s", text);
+}
+
+/* ################################################################################# */
+
+int main(int argc, char **argv) {
+    static LogReader reader;
+    static GameState gameState;
+    static SimState state;
+    static AnalyzeRoot root;
+    static AnalyzeWorker workers[ANALYZE_MAX_THREADS];
+    pthread_t threads[ANALYZE_MAX_THREADS];
+
+    int thread_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    double budget_ms = ANALYZE_DEFAULT_MS;
+    long first = 0, last = -1;
+    const char *path = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            thread_count = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-m") == 0 && i + 1 < argc) {
+            budget_ms = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            first = atol(argv[++i]);
+        } else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+            last = atol(argv[++i]);
+        } else {
+            path = argv[i];
+        }
+    }
+    if (path == NULL || !log_reader_open(&reader, path)) {
+        fprintf(stderr, "usage: %s <log> [-t threads] [-m ms_per_turn] [-f first] [-l last]\n", argv[0]);
+        return 1;
+    }
+    thread_count = thread_count < 1 ? 1 : thread_count > ANALYZE_MAX_THREADS ? ANALYZE_MAX_THREADS : thread_count;
+    if (last < 0 || last >= (long)reader.turn_count) {
+        last = (long)reader.turn_count - 1;
+    }
+
+    zobrist_init(1);
+    for (int i = 0; i < thread_count; i++) {
+        if (!duct_init(&workers[i].duct, 12345 + 7919 * (uint64_t)i)) {
+            fprintf(stderr, "out of memory for %d node pools\n", thread_count);
+            return 1;
+        }
+    }
+    printf("%s: turns %ld-%ld, %d threads, %.0f ms per turn\n", path, first, last, thread_count, budget_ms);
+
+    int blunders = 0;
+    for (long turn = first; turn <= last; turn++) {
+        if (!log_reader_game_state(&reader, (uint32_t)turn, &gameState)) {
+            fprintf(stderr, "turn %ld: corrupt record\n", turn);
+            return 1;
+        }
+        sim_load(&state, &gameState);
+        state.turn = (int)turn;
+
+        analyze_root_clear(&root);
+        for (int i = 0; i < thread_count; i++) {
+            workers[i].state = &state;
+            workers[i].root = &root;
+            workers[i].budget_ms = budget_ms;
+            pthread_create(&threads[i], NULL, analyze_worker, &workers[i]);
+        }
+        for (int i = 0; i < thread_count; i++) {
+            pthread_join(threads[i], NULL);
+        }
+
+        const AnalyzeSlot *best = analyze_best(&root, ME);
+        if (best == NULL) {
+            continue;
+        }
+        printf("turn %3ld  best ", turn);
+        analyze_print_move(&state, best->move);
+        printf(" %.3f (%lu)", analyze_value(best), (unsigned long)best->visits);
+
+        // The first action line of the turn is the one the search plays for
+        const LogTurn *t = log_reader_turn(&reader, (uint32_t)turn);
+        char line[LOG_MAX_ACTION_BYTES + 1];
+        snprintf(line, sizeof(line), "%.*s", (int)t->action_bytes, log_turn_actions(t));
+        line[strcspn(line, "\n")] = '\0';
+        uint32_t played;
+        if (line[0] == '\0') {
+            printf("\n");
+        } else if (!analyze_parse_move(&state, line, &played)) {
+            printf("  played %s\n", line);
+        } else {
+            const AnalyzeSlot *slot = analyze_slot(&root, ME, played);
+            printf("  played ");
+            analyze_print_move(&state, played);
+            if (slot == NULL || slot->visits == 0) {
+                printf(" unsearched !\n");
+                blunders++;
+            } else {
+                double delta = analyze_value(slot) - analyze_value(best);
+                printf(" %.3f (%lu) %+.3f%s\n", analyze_value(slot), (unsigned long)slot->visits, delta,
+                       delta < -ANALYZE_BLUNDER ? " ?" : "");
+                blunders += delta < -ANALYZE_BLUNDER;
+            }
+        }
+    }
+    printf("%d flagged turns, %ld iterations on the last turn\n", blunders, atomic_load(&root.iterations));
+
+    log_reader_close(&reader);
+    return 0;
+}
@@ -0,0 +1,631 @@
+// Micro-benchmarks for the boss1 search code.
+//
+//   gcc -O2 -o boss1Bench boss1Bench.c && ./boss1Bench [map.txt] [repetitions]
+//
+// The map is an ASCII drawing in the boss1Map.h legend ('#' wall, 'R' our root, 'A'
+// protein, 'E' empty, ...). Every non-wall cell is used once as a BFS start, the way a
+// turn runs one search per organ, and each variant reports the time per BFS.
+// Later sections time the distance fields, the scoring kernels, move generation, the
+// chokepoint and threat maps, the sporer ray tables and the endgame solver.
+//
+// Build it a second time with -DGRID_LAYOUT_MORTON to compare the cell layouts of
+// boss1Core.h on the same map; the header line names the layout in use.
+
+#define BOSS1_NO_MAIN
+#include "boss1DecidePathToA.c"
+#include "boss1Choke.h"
+#include "boss1Threat.h"
+#include "boss1DistField.h"
+#include "boss1Endgame.h"
+#include "boss1Map.h"
+#include "boss1Score.h"
+#include "boss1Sim.h"
+
+/* #############  BASELINE BFS VARIANTS ###################################### */
+
+// The original find_a_protein(): entity scans for walls and targets, bounds checks
+// and a memset of the visited and parent VLAs before every search
+Point legacy_find_a_protein(GameState *gameState, int start_x, int start_y, Point parent[][gameState->width]) {
+    int directions[4][2] = {{-1, 0}, {0, 1}, {1, 0}, {0, -1}};
+    Point queue[1000];
+    int front = 0, rear = 0;
+
+    bool visited[gameState->height][gameState->width];
+    memset(visited, false, sizeof(visited));
+    queue[rear++] = (Point){start_x, start_y};
+    visited[start_y][start_x] = true;
+    memset(parent, -1, sizeof(Point) * gameState->height * gameState->width);
+
+    while (front < rear) {
+        Point current = queue[front++];
+        for (int i = 0; i < gameState->entity_count; i++) {
+            if (gameState->entities[i].x == current.x && gameState->entities[i].y == current.y &&
+                strcmp(gameState->entities[i].type, "A") == 0) {
+                return current;
+            }
+        }
+        for (int i = 0; i < 4; i++) {
+            int new_x = current.x + directions[i][0];
+            int new_y = current.y + directions[i][1];
+            if (is_within_bounds(new_x, new_y, gameState) && !visited[new_y][new_x]) {
+                bool is_wall = false;
+                for (int j = 0; j < gameState->entity_count; j++) {
+                    if (gameState->entities[j].x == new_x && gameState->entities[j].y == new_y &&
+                        strcmp(gameState->entities[j].type, "WALL") == 0) {
+                        is_wall = true;
+                        break;
+                    }
+                }
+                if (!is_wall) {
+                    visited[new_y][new_x] = true;
+                    parent[new_y][new_x] = current;
+                    queue[rear++] = (Point){new_x, new_y};
+                }
+            }
+        }
+    }
+    return (Point){-1, -1};
+}
+
+// The same search on a dense row-major cell array: no entity scans, but still a
+// bounds check per neighbor and a memset of visited/parent per search
+Point dense_find_a_protein(const char *cells, int width, int height, int start_x, int start_y, Point *parent) {
+    static int queue[GRID_CELLS];
+    static bool visited[GRID_MAX_W * GRID_MAX_H];
+    int front = 0, rear = 0;
+
+    memset(visited, false, sizeof(bool) * width * height);
+    memset(parent, -1, sizeof(Point) * width * height);
+    queue[rear++] = start_y * width + start_x;
+    visited[start_y * width + start_x] = true;
+
+    while (front < rear) {
+        int current = queue[front++];
+        int x = current % width, y = current / width;
+        if (cells[current] == A_PROTEIN) {
+            return (Point){x, y};
+        }
+        for (int d = 3; d >= 0; d--) {
+            int new_x = x + dir_dx[d], new_y = y + dir_dy[d];
+            int next = new_y * width + new_x;
+            if (new_x >= 0 && new_x < width && new_y >= 0 && new_y < height && !visited[next] && cells[next] != WALL) {
+                visited[next] = true;
+                parent[next] = (Point){x, y};
+                queue[rear++] = next;
+            }
+        }
+    }
+    return (Point){-1, -1};
+}
+
+// The original sim_gen_grows(): every cell scanned for an organ of the owner, then its
+// neighbors deduplicated through a bitboard
+int scan_gen_grows(const SimState *s, int owner, uint32_t *moves, int max_moves) {
+    const Grid *g = &s->grid;
+    Bitboard seen;
+    int count = 0;
+    bool basic = sim_can_afford(s, owner, ORGAN_BASIC);
+    bool harvester = sim_can_afford(s, owner, ORGAN_HARVESTER);
+
+    bb_clear(&seen);
+    for (int from = 0; from < GRID_CELLS; from++) {
+        int piece = g->piece[from];
+        if (!piece_is_organ(piece) || piece_owner(piece) != owner) {
+            continue;
+        }
+        for (int d = 0; d < 4; d++) {
+            int to = grid_nb[from][d];
+            if (!piece_is_free(g->piece[to]) || bb_test(&seen, to)) {
+                continue;
+            }
+            bb_set(&seen, to);
+            if (basic && count < max_moves) {
+                moves[count++] = move_encode(from, to, ORGAN_BASIC, 0);
+            }
+            for (int f = 0; harvester && f < 4; f++) {
+                if (piece_is_protein(g->piece[grid_nb[to][f]]) && count < max_moves) {
+                    moves[count++] = move_encode(from, to, ORGAN_HARVESTER, f);
+                }
+            }
+        }
+    }
+    return count;
+}
+
+// Function to sum the targets, types and facings of a move list, whatever its order
+// and parents, so the two generators can be checked against each other
+static long moves_checksum(const uint32_t *moves, int n) {
+    long sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += (move_to(moves[i]) * 8 + move_type(moves[i])) * 4 + move_dir(moves[i]);
+    }
+    return sum;
+}
+
+// Function to compute choke_cut_area() for every open cell by brute force: take the
+// cell out, flood what is left of its component and count what misses the largest piece
+static void brute_cut_area(const Bitboard *open, int16_t cut[GRID_CELLS]) {
+    static VisitMarks seen;
+    static int queue[GRID_CELLS];
+    memset(cut, 0, sizeof(int16_t) * GRID_CELLS);
+    BB_FOREACH(open, u) {
+        int sizes[4] = {0, 0, 0, 0}, count = 1;
+        visit_begin(&seen);
+        visit_set(&seen, u);
+        for (int d = 0; d < 4; d++) {
+            int start = grid_nb[u][d];
+            if (!bb_test(open, start) || visit_seen(&seen, start)) {
+                continue;
+            }
+            int front = 0, rear = 0;
+            visit_set(&seen, start);
+            queue[rear++] = start;
+            while (front < rear) {
+                int c = queue[front++];
+                for (int e = 0; e < 4; e++) {
+                    int n = grid_nb[c][e];
+                    if (bb_test(open, n) && !visit_seen(&seen, n)) {
+                        visit_set(&seen, n);
+                        queue[rear++] = n;
+                    }
+                }
+            }
+            sizes[d] = rear;
+            count += rear;
+        }
+        int largest = 0;
+        for (int d = 0; d < 4; d++) {
+            largest = sizes[d] > largest ? sizes[d] : largest;
+        }
+        cut[u] = (int16_t)(count - 1 - largest);
+    }
+}
+
+/* ################################################################################# */
+
+int main(int argc, char **argv) {
+    static GameState gameState;
+    const char *filename = argc > 1 ? argv[1] : "map.txt";
+    int repetitions = argc > 2 ? atoi(argv[2]) : 200;
+
+    if (!map_load_ascii(filename, &gameState)) {
+        return 1;
+    }
+    Params defaults;
+    params_default(&defaults);
+    path_to_a_use(&defaults); // find_a_protein() expands neighbors in the parameter's order
+
+    static Grid grid;
+    static char cells[GRID_MAX_W * GRID_MAX_H];
+    grid_from_state(&grid, &gameState);
+    int starts[MAX_ENTITIES], start_count = 0;
+    for (int y = 0; y < gameState.height; y++) {
+        for (int x = 0; x < gameState.width; x++) {
+            int piece = grid.piece[grid_index(x, y)];
+            cells[y * gameState.width + x] = piece == PIECE_WALL ? WALL : piece == PIECE_PROTEIN ? A_PROTEIN : EMPTY;
+            if (piece != PIECE_WALL) {
+                starts[start_count++] = grid_index(x, y);
+            }
+        }
+    }
+
+    long searches = (long)repetitions * start_count;
+    long checksum[3] = {0, 0, 0};
+    double elapsed[3];
+    const char *names[3] = {"legacy (entity scan + memset)", "dense row-major + memset", "sentinel grid + 2-bit parents"};
+
+    double t0 = now_ms();
+    for (int r = 0; r < repetitions; r++) {
+        Point parent[gameState.height][gameState.width];
+        for (int i = 0; i < start_count; i++) {
+            Point p = legacy_find_a_protein(&gameState, grid_x(starts[i]), grid_y(starts[i]), parent);
+            checksum[0] += p.x * 31 + p.y;
+        }
+    }
+    elapsed[0] = now_ms() - t0;
+
+    t0 = now_ms();
+    for (int r = 0; r < repetitions; r++) {
+        static Point parent[GRID_MAX_W * GRID_MAX_H];
+        for (int i = 0; i < start_count; i++) {
+            Point p = dense_find_a_protein(cells, gameState.width, gameState.height, grid_x(starts[i]), grid_y(starts[i]), parent);
+            checksum[1] += p.x * 31 + p.y;
+        }
+    }
+    elapsed[1] = now_ms() - t0;
+
+    t0 = now_ms();
+    for (int r = 0; r < repetitions; r++) {
+        static PathTree tree;
+        for (int i = 0; i < start_count; i++) {
+            Point p = find_a_protein(&grid, grid_x(starts[i]), grid_y(starts[i]), &tree);
+            checksum[2] += p.x * 31 + p.y;
+        }
+    }
+    elapsed[2] = now_ms() - t0;
+
+#ifdef GRID_LAYOUT_MORTON
+    const char *layout = "Morton";
+#else
+    const char *layout = "row-major";
+#endif
+    printf("map %s: %dx%d, %d starts x %d repetitions, %s layout of %d cells\n", filename, gameState.width,
+           gameState.height, start_count, repetitions, layout, GRID_CELLS);
+    for (int v = 0; v < 3; v++) {
+        printf("%-32s %8.1f ns/BFS  %7.3f ms per 100 searches  (x%.1f)  checksum %ld\n", names[v],
+               elapsed[v] * 1e6 / searches, elapsed[v] * 100 / searches, elapsed[0] / elapsed[v], checksum[v]);
+    }
+
+    // Nearest-source fields for all four types: one bit-parallel pass vs one BFS per type
+    static DistField field;
+    static int16_t dist[GRID_CELLS];
+    int sources[4][GRID_CELLS], source_count[4] = {0, 0, 0, 0};
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        if (piece_is_protein(grid.piece[idx])) {
+            int t = grid.piece[idx] - PIECE_PROTEIN;
+            sources[t][source_count[t]++] = idx;
+        }
+    }
+    t0 = now_ms();
+    for (int r = 0; r < repetitions; r++) {
+        for (int t = 0; t < 4; t++) {
+            grid_bfs(&grid, sources[t], source_count[t], dist);
+        }
+    }
+    double per_type = (now_ms() - t0) * 1e6 / repetitions;
+    t0 = now_ms();
+    for (int r = 0; r < repetitions; r++) {
+        dist_field_build(&field, &grid);
+    }
+    double one_pass = (now_ms() - t0) * 1e6 / repetitions;
+    printf("%-32s %8.1f ns/turn\n%-32s %8.1f ns/turn  (x%.1f)\n", "distance fields, 4 x grid_bfs", per_type,
+           "distance fields, one pass", one_pass, per_type / one_pass);
+
+    // Candidate scoring: one full evaluation of every cell per weight vector, then top 8
+    static ScoreBoard board;
+    static ThreatMap score_threats;
+    threat_init(&score_threats, &grid, OPP);
+    score_build(&board, &grid, &field, ME, &score_threats);
+    struct { const char *name; ScoreKernel kernel; } kernels[] = {
+        {"score, scalar", score_eval_scalar},
+#ifdef SCORE_X86
+        {"score, SSE2", score_eval_sse2},
+        {"score, AVX2", __builtin_cpu_supports("avx2") ? score_eval_avx2 : NULL},
+#endif
+    };
+    int16_t weight[SCORE_LAYERS] = {4, 2, 3, 8};
+    long evaluations = (long)repetitions * 100;
+    double scalar_ns = 0;
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++) {
+        if (kernels[k].kernel == NULL) {
+            continue;
+        }
+        ScoredCell top[8];
+        long picked = 0;
+        t0 = now_ms();
+        for (long r = 0; r < evaluations; r++) {
+            weight[0] = (int16_t)(r & 7); // a new weight vector per evaluation, as a tuner would
+            kernels[k].kernel(&board, weight);
+            picked += score_top_k(&board, 8, top) + top[0].cell;
+        }
+        double ns = (now_ms() - t0) * 1e6 / evaluations;
+        scalar_ns = k == 0 ? ns : scalar_ns;
+        printf("%-32s %8.1f ns/eval+top8  (x%.1f)  checksum %ld\n", kernels[k].name, ns, scalar_ns / ns, picked);
+    }
+
+    // Move generation on positions sampled from random playouts of both owners
+    enum { SAMPLE_STATES = 64, SAMPLE_TURNS = 40 };
+    static SimState samples[SAMPLE_STATES];
+    static SimState playout;
+    static uint32_t moves[2][SIM_MAX_MOVES];
+    uint64_t rng = 0x9E3779B97F4A7C15ULL;
+    zobrist_init(1);
+    sim_load(&playout, &gameState);
+    for (int s = 0; s < SAMPLE_STATES; s++) {
+        if (s % 16 == 0) {
+            sim_load(&playout, &gameState);
+            sim_set_stock(&playout, ME, 0, 60);
+            sim_set_stock(&playout, OPP, 0, 60);
+        }
+        for (int t = 0; t < SAMPLE_TURNS / 16; t++) {
+            uint32_t pick[2];
+            for (int o = 0; o < 2; o++) {
+                int n = sim_gen_grows(&playout, o, moves[o], SIM_MAX_MOVES);
+                rng ^= rng << 13, rng ^= rng >> 7, rng ^= rng << 17;
+                pick[o] = n ? moves[o][rng % n] : MOVE_WAIT;
+            }
+            sim_apply_joint(&playout, pick[ME], pick[OPP]);
+            sim_end_turn(&playout);
+        }
+        samples[s] = playout;
+    }
+    long generated[2] = {0, 0}, sums[2] = {0, 0};
+    double gen_ns[2];
+    int (*generators[2])(const SimState *, int, uint32_t *, int) = {scan_gen_grows, sim_gen_grows};
+    for (int v = 0; v < 2; v++) {
+        t0 = now_ms();
+        for (int r = 0; r < repetitions * 10; r++) {
+            for (int s = 0; s < SAMPLE_STATES; s++) {
+                int n = generators[v](&samples[s], r & 1, moves[0], SIM_MAX_MOVES);
+                generated[v] += n;
+                sums[v] += r < 2 ? moves_checksum(moves[0], n) : 0;
+            }
+        }
+        gen_ns[v] = (now_ms() - t0) * 1e6 / ((double)repetitions * 10 * SAMPLE_STATES);
+    }
+    printf("%-32s %8.1f ns/call  %.1f moves  checksum %ld\n%-32s %8.1f ns/call  (x%.1f)  checksum %ld\n",
+           "moves, grid scan", gen_ns[0], (double)generated[0] / ((double)repetitions * 10 * SAMPLE_STATES), sums[0],
+           "moves, frontier", gen_ns[1], gen_ns[0] / gen_ns[1], sums[1]);
+
+    // Whole random playouts, which pay for the frontier upkeep on every placed organ
+    long placed = 0;
+    t0 = now_ms();
+    for (int r = 0; r < repetitions * 10; r++) {
+        playout = samples[r % SAMPLE_STATES];
+        for (int t = 0; t < 8; t++) {
+            uint32_t pick[2];
+            for (int o = 0; o < 2; o++) {
+                int n = sim_gen_grows(&playout, o, moves[o], SIM_MAX_MOVES);
+                rng ^= rng << 13, rng ^= rng >> 7, rng ^= rng << 17;
+                pick[o] = n ? moves[o][rng % n] : MOVE_WAIT;
+            }
+            sim_apply_joint(&playout, pick[ME], pick[OPP]);
+            sim_end_turn(&playout);
+        }
+        placed += playout.organ_count[ME] + playout.organ_count[OPP];
+    }
+    printf("%-32s %8.1f ns/playout (copy + 8 turns)  checksum %ld\n", "playouts", (now_ms() - t0) * 1e6 / (repetitions * 10.0),
+           placed);
+
+    // Chokepoints along playouts: the incremental sync after each turn vs a Tarjan pass
+    // over the whole grid with the organs walled (choke_init() on that grid). Both must
+    // agree with taking every open cell out in turn and flooding the rest (untimed).
+    static ChokeMap choke, rebuilt;
+    static Grid organs_walled;
+    static int16_t brute_cut[GRID_CELLS];
+    double choke_ns[2] = {0, 0};
+    long choke_turns = 0, choke_mismatches = 0;
+    choke_init(&choke, &samples[0].grid);
+    for (int r = 0; r < repetitions / 10 + 1; r++) {
+        playout = samples[r % SAMPLE_STATES];
+        for (int t = 0; t < 8; t++, choke_turns++) {
+            uint32_t pick[2];
+            for (int o = 0; o < 2; o++) {
+                int n = sim_gen_grows(&playout, o, moves[o], SIM_MAX_MOVES);
+                rng ^= rng << 13, rng ^= rng >> 7, rng ^= rng << 17;
+                pick[o] = n ? moves[o][rng % n] : MOVE_WAIT;
+            }
+            sim_apply_joint(&playout, pick[ME], pick[OPP]);
+            sim_end_turn(&playout);
+            t0 = now_ms();
+            choke_sync(&choke, &playout.grid);
+            choke_ns[1] += now_ms() - t0;
+            t0 = now_ms();
+            organs_walled = playout.grid;
+            for (int c = 0; c < GRID_CELLS; c++) {
+                if (piece_is_organ(organs_walled.piece[c])) {
+                    organs_walled.piece[c] = PIECE_WALL;
+                }
+            }
+            choke_init_with(&rebuilt, &organs_walled, false);
+            choke_ns[0] += now_ms() - t0;
+            brute_cut_area(&choke.open, brute_cut);
+            BB_FOREACH(&choke.open, c) {
+                choke_mismatches += brute_cut[c] != choke_cut_area(&choke, c) ||
+                                    (brute_cut[c] > 0) != choke_is_articulation(&choke, c) ||
+                                    choke_cut_area(&rebuilt, c) != choke_cut_area(&choke, c);
+            }
+            choke_mismatches += memcmp(&rebuilt.open, &choke.open, sizeof(Bitboard)) != 0;
+        }
+    }
+    printf("%-32s %8.1f ns/turn\n%-32s %8.1f ns/turn  (x%.1f)  %ld mismatches\n", "chokepoints, Tarjan rebuild",
+           choke_ns[0] * 1e6 / choke_turns, "chokepoints, incremental sync", choke_ns[1] * 1e6 / choke_turns,
+           choke_ns[0] / choke_ns[1], choke_mismatches);
+
+    // Threat map along playouts where both sides can afford tentacles and organs die: a
+    // threat_init() from the whole grid vs threat_sync() from the turn's entity list (what
+    // pathToA runs), threat_sync_grid() (what greedy runs) and threat_set_cell() on the
+    // cells known to change, which must all agree
+    static ThreatMap threat[4];
+    static GameState threat_state;
+    const char *threat_names[4] = {"threats, full rebuild", "threats, sync from input", "threats, sync from grid",
+                                   "threats, changed cells"};
+    double threat_ns[4] = {0, 0, 0, 0};
+    long threat_turns = 0, threat_mismatches = 0;
+    for (int r = 0; r < repetitions; r++) {
+        playout = samples[r % SAMPLE_STATES];
+        for (int o = 0; o < 2; o++) {
+            for (int t = 0; t < 4; t++) {
+                sim_set_stock(&playout, o, t, 50);
+            }
+        }
+        for (int k = 1; k < 4; k++) {
+            threat_init(&threat[k], &playout.grid, OPP);
+        }
+        for (int t = 0; t < 8; t++, threat_turns++) {
+            uint32_t pick[2];
+            int changed[3], changed_count = 0;
+            for (int o = 0; o < 2; o++) {
+                int n = sim_gen_grows(&playout, o, moves[o], SIM_MAX_MOVES);
+                rng ^= rng << 13, rng ^= rng >> 7, rng ^= rng << 17;
+                pick[o] = n ? moves[o][rng % n] : MOVE_WAIT;
+                if (pick[o] != MOVE_WAIT && rng % 3 == 0) {
+                    pick[o] = move_encode(move_from(pick[o]), move_to(pick[o]), ORGAN_TENTACLE, (int)(rng >> 8) % 4);
+                }
+                if (pick[o] != MOVE_WAIT) {
+                    changed[changed_count++] = move_to(pick[o]);
+                }
+            }
+            sim_apply_joint(&playout, pick[ME], pick[OPP]);
+            sim_end_turn(&playout);
+            if (t % 3 == 2 && changed_count > 0 && piece_is_organ(playout.grid.piece[changed[0]])) {
+                // a tentacle ate the organ grown this turn
+                sim_set_piece(&playout, changed[0], PIECE_EMPTY, 0);
+            }
+            sim_to_game_state(&playout, ME, &threat_state);
+            t0 = now_ms();
+            threat_init(&threat[0], &playout.grid, OPP);
+            threat_ns[0] += now_ms() - t0;
+            t0 = now_ms();
+            threat_sync(&threat[1], &playout.grid, &threat_state, playout.proteins[OPP]);
+            threat_ns[1] += now_ms() - t0;
+            t0 = now_ms();
+            threat_sync_grid(&threat[2], &playout.grid, playout.proteins[OPP]);
+            threat_ns[2] += now_ms() - t0;
+            t0 = now_ms();
+            for (int c = 0; c < changed_count; c++) {
+                threat_set_cell(&threat[3], changed[c], playout.grid.piece[changed[c]]);
+            }
+            threat_ns[3] += now_ms() - t0;
+            for (int k = 1; k < 4; k++) {
+                threat_mismatches += memcmp(threat[0].now, threat[k].now, sizeof(threat[0].now)) != 0 ||
+                                     memcmp(threat[0].next, threat[k].next, sizeof(threat[0].next)) != 0 ||
+                                     memcmp(&threat[0].growable, &threat[k].growable, sizeof(Bitboard)) != 0;
+            }
+        }
+    }
+    printf("%-32s %8.1f ns/turn\n", threat_names[0], threat_ns[0] * 1e6 / threat_turns);
+    for (int k = 1; k < 4; k++) {
+        printf("%-32s %8.1f ns/turn  (x%.1f)\n", threat_names[k], threat_ns[k] * 1e6 / threat_turns,
+               threat_ns[0] / threat_ns[k]);
+    }
+    printf("%-32s %ld mismatches\n", "threats, vs full rebuild", threat_mismatches);
+
+    // Ray tables: every cell listed vs the canonical half on a symmetric map, which must
+    // read back the same cells; random point-symmetric maps if map.txt is not symmetric
+    static RayTable tables[2];
+    static GameState sym_state;
+    static Grid sym_grid;
+    sym_state = gameState;
+    grid_from_state(&sym_grid, &sym_state);
+    for (uint64_t map_rng = 7; symmetry_detect(&tables[1].sym, &sym_grid) == SYM_NONE;) {
+        map_random(&sym_state, &map_rng);
+        grid_from_state(&sym_grid, &sym_state);
+    }
+    int pool_used[2] = {0, 0};
+    double ray_ns[2];
+    sym_fill(&tables[0].sym, SYM_NONE, sym_grid.width, sym_grid.height);
+    t0 = now_ms();
+    for (int r = 0; r < repetitions; r++) {
+        symmetry_detect(&tables[1].sym, &sym_grid);
+    }
+    double detect_ns = (now_ms() - t0) * 1e6 / repetitions;
+    for (int v = 0; v < 2; v++) {
+        t0 = now_ms();
+        for (int r = 0; r < repetitions; r++) {
+            pool_used[v] = rays_list(&tables[v], &sym_grid);
+        }
+        ray_ns[v] = (now_ms() - t0) * 1e6 / repetitions;
+        rays_mask(&tables[v], &sym_grid);
+    }
+    long ray_mismatches = 0;
+    for (int c = 0; c < GRID_CELLS; c++) {
+        for (int d = 0; d < 4; d++) {
+            ray_mismatches += tables[0].length[c][d] != tables[1].length[c][d] || tables[0].open[c][d] != tables[1].open[c][d];
+            for (int k = 0; k < tables[0].length[c][d] && k < tables[1].length[c][d]; k++) {
+                ray_mismatches += rays_cell(&tables[0], c, d, k) != rays_cell(&tables[1], c, d, k);
+            }
+        }
+    }
+    printf("%-32s %8.1f ns/list  %d pool cells\n%-32s %8.1f ns/list  %d pool cells (x%.1f)  %ld mismatches\n",
+           "rays, every cell", ray_ns[0], pool_used[0], "rays, canonical half", ray_ns[1], pool_used[1],
+           ray_ns[0] / ray_ns[1], ray_mismatches);
+    printf("%-32s %8.1f ns/game  %dx%d, %s\n", "symmetry detection", detect_ns, sym_grid.width, sym_grid.height,
+           sym_name(tables[1].sym.kind));
+
+    // Chokepoints of the walls alone: every component vs mirrored components copied.
+    // The second grid walls off the cells on or next to the mirror axis, so that each
+    // half becomes a component of its own and the copy path is exercised too.
+    static Grid split_grid;
+    split_grid = sym_grid;
+    sym_fill(&tables[0].sym, tables[1].sym.kind, sym_grid.width, sym_grid.height);
+    for (int y = 0; y < sym_grid.height; y++) {
+        for (int x = 0; x < sym_grid.width; x++) {
+            int c = grid_index(x, y), image = sym_cell(&tables[0].sym, c);
+            for (int d = 0; d < 4; d++) {
+                if (image == c || grid_nb[c][d] == image) {
+                    split_grid.piece[c] = PIECE_WALL;
+                }
+            }
+        }
+    }
+    const Grid *choke_grids[2] = {&sym_grid, &split_grid};
+    for (int g = 0; g < 2; g++) {
+        static ChokeMap wall_choke[2];
+        double wall_choke_ns[2];
+        for (int v = 0; v < 2; v++) {
+            t0 = now_ms();
+            for (int r = 0; r < repetitions; r++) {
+                choke_init_with(&wall_choke[v], choke_grids[g], v == 1);
+            }
+            wall_choke_ns[v] = (now_ms() - t0) * 1e6 / repetitions;
+        }
+        long wall_choke_mismatches = 0;
+        for (int c = 0; c < GRID_CELLS; c++) {
+            wall_choke_mismatches += choke_cut_area(&wall_choke[0], c) != choke_cut_area(&wall_choke[1], c) ||
+                                     choke_is_articulation(&wall_choke[0], c) != choke_is_articulation(&wall_choke[1], c);
+        }
+        printf("%-32s %8.1f ns/game\n%-32s %8.1f ns/game  (x%.1f)  %ld mismatches, %d components%s\n",
+               "chokepoints, every component", wall_choke_ns[0], "chokepoints, mirrored copied", wall_choke_ns[1],
+               wall_choke_ns[0] / wall_choke_ns[1], wall_choke_mismatches, wall_choke[1].next_comp,
+               g ? ", axis walled off" : "");
+    }
+
+    // Endgame solver on open blocks with the organs in opposite corners, the slowest
+    // shape for their size: a block of ENDGAME_MAX_CONTESTED cells must solve in the
+    // duct bot's share of the turn, one cell more is not listed at all. Then 17
+    // contested one-cell pockets, one more than endgame_move() lists, which must not
+    // count as an endgame.
+    static TransTable endgame_table;
+    tt_init(&endgame_table, (size_t)ENDGAME_TT_MB << 20);
+    static EndgameRegion endgame_region[16];
+    static Grid block;
+    int block_size[2][2] = {{5, ENDGAME_MAX_CONTESTED / 5}, {5, ENDGAME_MAX_CONTESTED / 5 + 1}};
+    for (int k = 0; k < 2; k++) {
+        int w = block_size[k][0], h = block_size[k][1];
+        grid_clear(&block, w + 2, h);
+        for (int y = 0; y < h; y++) {
+            block.piece[grid_index(0, y)] = PIECE_WALL;
+            block.piece[grid_index(w + 1, y)] = PIECE_WALL;
+        }
+        block.piece[grid_index(0, 0)] = (uint8_t)organ_piece(ME, ORGAN_ROOT, 0);
+        block.piece[grid_index(w + 1, h - 1)] = (uint8_t)organ_piece(OPP, ORGAN_ROOT, 0);
+        bool all_small;
+        int listed = endgame_regions(&block, endgame_region, 16, &all_small);
+        if (listed == 0) {
+            printf("%-24s %dx%d not listed, all_small %d\n", "endgame, open block", w, h, all_small);
+            continue;
+        }
+        for (int run = 0; run < 3; run++) { // the first run pays for the table's pages
+            int owner = run == 2 ? OPP : ME, cell, value;
+            long nodes;
+            tt_new_generation(&endgame_table);
+            t0 = now_ms();
+            bool solved = endgame_solve(&endgame_table, &endgame_region[0], owner, now_ms() + 1000.0, &cell, &value,
+                                        &nodes);
+            if (run > 0) {
+                printf("%-24s %dx%d %8.3f ms/solve  %ld nodes, value %d, %s first%s\n", "endgame, open block", w, h,
+                       now_ms() - t0, nodes, value, owner == ME ? "we move" : "they move", solved ? "" : ", TIMEOUT");
+            }
+        }
+    }
+    grid_clear(&block, 18, 7);
+    for (int x = 0; x < 18; x++) {
+        block.piece[grid_index(x, 3)] = PIECE_WALL;
+    }
+    for (int i = 0; i < 18; i++) { // a pocket between our organ above and theirs below
+        int x = 2 * (i % 9), y = 4 * (i / 9);
+        for (int dy = 0; dy < 3; dy++) {
+            block.piece[grid_index(x + 1, y + dy)] = PIECE_WALL;
+            block.piece[grid_index(x, y + dy)] = i == 17 ? PIECE_WALL : PIECE_EMPTY;
+        }
+        if (i < 17) {
+            block.piece[grid_index(x, y)] = (uint8_t)organ_piece(ME, ORGAN_ROOT, 0);
+            block.piece[grid_index(x, y + 2)] = (uint8_t)organ_piece(OPP, ORGAN_ROOT, 0);
+        }
+    }
+    bool pockets_small;
+    int pockets = endgame_regions(&block, endgame_region, 16, &pockets_small);
+    printf("%-32s %d listed, all_small %d\n", "endgame, 17 contested pockets", pockets, pockets_small);
+    return 0;
+}
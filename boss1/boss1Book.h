@@ -0,0 +1,140 @@
+#ifndef BOSS1_BOOK_H
+#define BOSS1_BOOK_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+#include "boss1Zobrist.h"
+#include "boss1Sim.h"
+
+// Opening book: our first BOOK_TURNS moves for known start positions, searched offline
+// by boss1BookGen and embedded as boss1BookData.h. A line is found on turn 0 by the
+// hash of the walls and protein sources, then followed while every turn's state still
+// matches the state the offline search expected; the first mismatch (the opponent
+// played something else) leaves the book for good.
+//
+// Hashes and moves use map coordinates, not grid indices, so a book stays valid for
+// any GRID_MAX_W / GRID_MAX_H or cell layout the bot is built with.
+//
+// The key is exact: every wall and protein source of the map, and every piece and
+// stock of the state. The book therefore only fires on the very maps it was generated
+// from; the shipped boss1BookData.h holds boss1BookGen's random point-symmetric maps,
+// which an arena game does not reproduce, so there it always misses and the duct bot
+// searches from turn 0. Lines pay off only for maps fed to boss1BookGen by name.
+
+#define BOOK_TURNS 4
+#define BOOK_MISS 0xFFFFFFFFu         // no book move; MOVE_WAIT is a legitimate book move
+
+typedef struct {
+    uint64_t map_hash;                // walls and protein sources, sorted ascending in the table
+    uint64_t state_hash[BOOK_TURNS];  // full state before our move on each turn
+    uint32_t move[BOOK_TURNS];        // book_pack()ed moves
+} BookEntry;
+
+#if defined(__has_include)
+#if __has_include("boss1BookData.h")
+#include "boss1BookData.h"
+#endif
+#endif
+
+#ifndef BOOK_ENTRY_COUNT // no generated book
+#define BOOK_ENTRY_COUNT 0
+#endif
+#if BOOK_ENTRY_COUNT == 0
+static const BookEntry book_entries[1]; // never read: the search range is empty
+#endif
+
+/* #############  KEYS ####################################################### */
+
+static inline uint64_t book_cell_key(int x, int y, int piece) {
+    return zobrist_mix(((uint64_t)(y * 64 + x) << 8 | (uint64_t)piece) ^ 0xB00C);
+}
+
+// Function to hash the static layout: size, walls and protein sources
+uint64_t book_map_hash(const Grid *g) {
+    uint64_t h = zobrist_mix((uint64_t)g->width << 8 | (uint64_t)g->height);
+    for (int y = 0; y < g->height; y++) {
+        for (int x = 0; x < g->width; x++) {
+            int piece = g->piece[grid_index(x, y)];
+            if (piece == PIECE_WALL || piece_is_protein(piece)) {
+                h ^= book_cell_key(x, y, piece);
+            }
+        }
+    }
+    return h;
+}
+
+// Function to hash everything a search sees: every piece, both stocks and the turn
+uint64_t book_state_hash(const SimState *s) {
+    uint64_t h = book_map_hash(&s->grid) ^ zobrist_mix(0xB00C0000u + (uint64_t)s->turn);
+    for (int y = 0; y < s->grid.height; y++) {
+        for (int x = 0; x < s->grid.width; x++) {
+            int piece = s->grid.piece[grid_index(x, y)];
+            if (piece_is_organ(piece)) {
+                h ^= book_cell_key(x, y, piece);
+            }
+        }
+    }
+    for (int o = 0; o < 2; o++) {
+        for (int t = 0; t < 4; t++) {
+            h ^= zobrist_mix(((uint64_t)(o * 4 + t) << 32 | (uint64_t)s->proteins[o][t]) ^ 0xB00C5);
+        }
+    }
+    return h;
+}
+
+// Moves in map coordinates: from x/y 5+4 bits, to x/y 5+4 bits, type 3, dir 2, valid 1
+static inline uint32_t book_pack(uint32_t move) {
+    if (move == MOVE_WAIT) {
+        return MOVE_WAIT;
+    }
+    int from = move_from(move), to = move_to(move);
+    return (uint32_t)grid_x(from) | (uint32_t)grid_y(from) << 5 | (uint32_t)grid_x(to) << 9 |
+           (uint32_t)grid_y(to) << 14 | (uint32_t)move_type(move) << 18 | (uint32_t)move_dir(move) << 21 | 1u << 23;
+}
+
+static inline uint32_t book_unpack(uint32_t packed) {
+    if (packed == MOVE_WAIT) {
+        return MOVE_WAIT;
+    }
+    int from = grid_index(packed & 31, (packed >> 5) & 15), to = grid_index((packed >> 9) & 31, (packed >> 14) & 15);
+    return move_encode(from, to, (packed >> 18) & 7, (packed >> 21) & 3);
+}
+
+/* ################################################################################# */
+
+/* #############  LOOKUP ##################################################### */
+
+// Function to find the line for a start position, NULL if the map is not in the book
+const BookEntry *book_find(const SimState *s) {
+    uint64_t key = book_map_hash(&s->grid);
+    int lo = 0, hi = BOOK_ENTRY_COUNT - 1;
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        if (book_entries[mid].map_hash == key) {
+            return &book_entries[mid];
+        }
+        if (book_entries[mid].map_hash < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    return NULL;
+}
+
+// Function to read the book move for this turn, BOOK_MISS once the game left the line
+uint32_t book_move(const BookEntry *line, const SimState *s) {
+    if (line == NULL || s->turn < 0 || s->turn >= BOOK_TURNS || line->state_hash[s->turn] != book_state_hash(s)) {
+        return BOOK_MISS;
+    }
+    return book_unpack(line->move[s->turn]);
+}
+
+/* ################################################################################# */
+
+#endif
@@ -0,0 +1,68 @@
+// Generated by boss1BookGen: 64 lines, 1000 ms per search, 4 turns each
+#define BOOK_ENTRY_COUNT 64
+static const BookEntry book_entries[BOOK_ENTRY_COUNT] = {
+    {0x0165e515bede5bd0ULL, {0xcd067a5d233e3ee8ULL, 0x407506611c5fcfb8ULL, 0x4fadd55e8448f5b0ULL, 0xd3deec01c06e8e4bULL}, {0x84c463u, 0x84c262u, 0x88c061u, 0x84c863u}},
+    {0x03d6e9b4b8350f92ULL, {0xa1ffa6fc3960e900ULL, 0xeea7513a79e4cb1dULL, 0x286bd1cad2144d42ULL, 0xff8f2437cdd95686ULL}, {0xe982c2u, 0x8586c2u, 0x8588c3u, 0x858ac4u}},
+    {0x089ca7f26e9b21d3ULL, {0x1036049314519267ULL, 0xb240536bed4e1c5eULL, 0xa6bd4ac07b2cbbc7ULL, 0x41b50dedbd99fc25ULL}, {0x8588c3u, 0xa98ac4u, 0xa9cac5u, 0x860ae5u}},
+    {0x0c78b964c520c17dULL, {0x2435138d8fbcff01ULL, 0xc598db5c2523a561ULL, 0x7f0b57d32c89fedfULL, 0xa3c0a88285fbf0c6ULL}, {0x844241u, 0x8542c1u, 0x84c241u, 0xa8c461u}},
+    {0x0d122c666b905973ULL, {0x42c0f042e1f4bec0ULL, 0x0b624d5d826e1027ULL, 0x81e1764d399b43faULL, 0x9ccc05e7a9372e3eULL}, {0x860903u, 0x860b04u, 0x8a0d05u, 0x860503u}},
+    {0x10c6dc2ad821c405ULL, {0xbf608ef319166866ULL, 0x6664dcb6577506e3ULL, 0xd85ca824bbfa1b0fULL, 0xa228c0280cb4ac2eULL}, {0x844622u, 0x848422u, 0xc8c442u, 0x000000u}},
+    {0x14162b7f7fde3a85ULL, {0x920a564238fbc574ULL, 0x681723902afc84f6ULL, 0x96fdf8aeb5d5f4c1ULL, 0xc9be5d8c1ac7ed9cULL}, {0x8606e3u, 0x860503u, 0x864703u, 0x864923u}},
+    {0x18d86ae3ef78d963ULL, {0x7ec107803821cf4fULL, 0x502d7444594feb29ULL, 0x2dfe82fe846910faULL, 0x2b3df1e545321f14ULL}, {0x8544a3u, 0x8584a2u, 0xe982c2u, 0x8548a3u}},
+    {0x211d0fa5ec00e2feULL, {0x95815df31673d967ULL, 0xd5b8033a023d0668ULL, 0x6b8077a8eeb21b84ULL, 0xafab7641d239fabcULL}, {0x844421u, 0x848422u, 0x848642u, 0x84c643u}},
+    {0x247d3647b09d500cULL, {0xf1a8a210e40e471eULL, 0xc4eb7aa16cc74c5cULL, 0x9975aa688d02429bULL, 0xe88d21b17a07d6a8ULL}, {0x85c6e2u, 0x8586e3u, 0x8588c3u, 0x858ac4u}},
+    {0x28724f47b815029cULL, {0xabffa8ae7445d32fULL, 0x3b6bd2be7b2cfa05ULL, 0xd7e33837dcd0cd43ULL, 0xdb3cfafa1a3792e9ULL}, {0x8502a1u, 0xa90481u, 0xa90682u, 0xc90883u}},
+    {0x2d3038ac3a4e749aULL, {0x493a52ec5ff77ca2ULL, 0x07d9fe2363fd7605ULL, 0xa0b88273e525a0cbULL, 0x268c6cf83c20cba0ULL}, {0x850682u, 0x850883u, 0x890a84u, 0x850c85u}},
+    {0x34fefccedb2abaf4ULL, {0x6a5088234d4988e2ULL, 0x10b8746dbcb949e1ULL, 0x44ce7c98f2978b19ULL, 0x7180516cc25926ecULL}, {0x8504a2u, 0x88c482u, 0x848462u, 0x8542a2u}},
+    {0x376fca3e5f54f83cULL, {0x2ceae6960cd1c8deULL, 0xdacca4508a9354fbULL, 0xb17f4e024ca7a898ULL, 0x20f47a46cd4b7876ULL}, {0x84c461u, 0x84c662u, 0x850663u, 0x850883u}},
+    {0x3ab8f98a0312d46dULL, {0xbf567d5aadc5c0feULL, 0xc2d0243ba193576dULL, 0x1155fa6ad27b809cULL, 0x29118f6db244d619ULL}, {0x84c281u, 0x84c461u, 0x888462u, 0x844442u}},
+    {0x42dde2d4494c6ba2ULL, {0x2b9b7d2e1d0102bfULL, 0x7fbb76b7e37b154aULL, 0x42d62672ecb76d8cULL, 0xf6df559e85f082eaULL}, {0xa986c2u, 0x8588c3u, 0x858ac4u, 0x85c4c2u}},
+    {0x4b7acd06ba6ede46ULL, {0x908c4b4015f66480ULL, 0x7f79b34aeddbca94ULL, 0xe811c320486cf18bULL, 0x5a7cf11ab2bf5ef6ULL}, {0x848422u, 0x84c442u, 0xa8c662u, 0x84c863u}},
+    {0x4decf8e1683daa65ULL, {0x90dc396deb645140ULL, 0x7f4bf8b7a75c8922ULL, 0xa89bc50d15a69320ULL, 0xecaee3ccc24a0969ULL}, {0x84c463u, 0xe88462u, 0x844442u, 0x84c863u}},
+    {0x4e0e544763401248ULL, {0xd6dbb62549da5b95ULL, 0xb286d8c5c407accfULL, 0xc6350969b0e4e3deULL, 0xbd7814746e2c7d28ULL}, {0x844222u, 0x844021u, 0x844622u, 0x844823u}},
+    {0x4ff53b2dbb635ca7ULL, {0xd87c539413928dbaULL, 0x43906afabb274ca1ULL, 0xd08c01655a4f492eULL, 0x0aed4dd65733e23bULL}, {0x8544c2u, 0x8542a2u, 0x8940a1u, 0x85c4c2u}},
+    {0x56134370987f82f1ULL, {0xce07ef7729f023f6ULL, 0xa1ffa991bd9cd1aeULL, 0x721e1c93526b09d3ULL, 0x44acbf140e4d98fcULL}, {0x850682u, 0xa94683u, 0x850883u, 0x850a84u}},
+    {0x5a77bf828ad0b5c8ULL, {0x1444d26d6fcc7b16ULL, 0x73f8b293da3c29b0ULL, 0xe7399e4ffe6a8b90ULL, 0x6e7a9f3e77b1721dULL}, {0x85c4e3u, 0xc9c2e2u, 0x85c8e3u, 0x8608e4u}},
+    {0x5c31cb44d3cd27dbULL, {0xcbed3d236a89dac5ULL, 0x5a5f8217a20ef6acULL, 0xf8f5b247f3ae45cbULL, 0x56cdd13e8e39321bULL}, {0x850682u, 0x850282u, 0x850883u, 0xe94884u}},
+    {0x5c54bcaaa5364c88ULL, {0x86e7d502deff65fbULL, 0xe016c82ca5b7e691ULL, 0x7d1cae33b6c80adaULL, 0x960a46e1e9778982ULL}, {0x8588c3u, 0x858ac4u, 0x858cc5u, 0x898ec6u}},
+    {0x614dc562fb021e4cULL, {0xe09de5c29b435f0dULL, 0x815b980b839f344dULL, 0x57ffde31e86f4948ULL, 0x71e28d647560ada2ULL}, {0x860702u, 0x860903u, 0x860b04u, 0xa9cb05u}},
+    {0x69cc5dcfcdaedc0bULL, {0xca69a22d6d922913ULL, 0x25e97b1f3026725bULL, 0x52d3ae764deb75c6ULL, 0xbb8dc3e1186d9b01ULL}, {0x848441u, 0x848642u, 0x848843u, 0x84c844u}},
+    {0x6a827af47a6ea2d7ULL, {0x23d8260ea75d7cb9ULL, 0xea184f55a7e6073eULL, 0x51d4e35904b4d40eULL, 0x690a57f00b289040ULL}, {0x864703u, 0xca8723u, 0x85c703u, 0x868543u}},
+    {0x6be001e6eeb0ca1fULL, {0x10faad6a6b2176b1ULL, 0x1b3b6c8221c31649ULL, 0x42ee0452a8b2650bULL, 0x9a2bb79c2bdc180cULL}, {0x8584a2u, 0x85c4c2u, 0xea04e2u, 0x8504a2u}},
+    {0x6f4deaba6dcc75f5ULL, {0xb095698ea1fe893fULL, 0x34233272838cbd03ULL, 0x8ccfb41f7ac1ab36ULL, 0x200bd942c8c0f4c7ULL}, {0x850483u, 0x854482u, 0x8542a2u, 0x850883u}},
+    {0x71f90ac914cd29efULL, {0x0f4f3ba55b0b4107ULL, 0xf8519de1623093f0ULL, 0xd36ab12b11ff4952ULL, 0xf440fe424b5166ddULL}, {0x850282u, 0xe8c281u, 0x848261u, 0x850682u}},
+    {0x72fcb7957e1bae09ULL, {0x7e606eb629137aadULL, 0xac14ad1bac063db8ULL, 0xa970e31a0bc185f7ULL, 0x4ae41d3892eeca83ULL}, {0x884442u, 0x844222u, 0x844021u, 0xa80221u}},
+    {0x73d5189132ce9180ULL, {0x0e8f33aea0538c16ULL, 0xdf5302507674055aULL, 0xff8211c101983dadULL, 0x465775bfa9e8fad8ULL}, {0x8542a2u, 0x8540a1u, 0xc980a0u, 0x8584a2u}},
+    {0x7761d11c12ecdf9cULL, {0xd8c783c5d3db73ffULL, 0x01c3d1809db81d7aULL, 0xeed63a61c73a4a91ULL, 0x62e164c082730c94ULL}, {0x844622u, 0x840623u, 0x840803u, 0x840a04u}},
+    {0x77d17ee2e5cebb5fULL, {0xce72bc2050ecb748ULL, 0xc4db6151a92a3c07ULL, 0xd44074e4a961667bULL, 0x1cc7bba3359c8ff0ULL}, {0x84c863u, 0x84ca64u, 0x88cc65u, 0x84c463u}},
+    {0x7fff86d4e907d0b5ULL, {0x1ec6d99526e9b8b4ULL, 0xa3f97f34fbf392cdULL, 0x2e56eb8700807cc4ULL, 0xc5d017bd1ae12c99ULL}, {0x848422u, 0x848242u, 0x84c442u, 0x850462u}},
+    {0x81bd3213adbaf357ULL, {0xdd351cdfc4bd772fULL, 0x80ad8410bbf2caebULL, 0xc4790008ffba7da2ULL, 0xfe3905c72bed1bf0ULL}, {0x8584c3u, 0x8582c2u, 0xe942c1u, 0x8588c3u}},
+    {0x90d0091a70106d4bULL, {0x52d3834c5dbdccafULL, 0x9a4514cd72b0db3aULL, 0xe1b1feb054dead38ULL, 0x82ad89b167fa5fddULL}, {0x84c241u, 0x850261u, 0x854281u, 0x8582a1u}},
+    {0x90d783aff800d22bULL, {0x4ad5568e0bc7ab14ULL, 0x267ebb28f7d14febULL, 0xdb230713baceb2c0ULL, 0x42475f612c7785aeULL}, {0x848462u, 0x844442u, 0x840422u, 0xc90462u}},
+    {0x9917ab7bfbb3c01bULL, {0xac038bf71ad71596ULL, 0x1f92d39b6a0412e0ULL, 0x82cc87edbd596665ULL, 0x6a0e1779d333cc11ULL}, {0x860321u, 0xe9c301u, 0x868321u, 0x868541u}},
+    {0x9932d07352580bc0ULL, {0xe2bbfee3135690f8ULL, 0x9ed0afe1dca8cba6ULL, 0xbea56bdb143d6ab0ULL, 0x953b374c5aaa20e7ULL}, {0x850462u, 0xc94482u, 0x8584a2u, 0x8582c2u}},
+    {0x9c13600f9663842fULL, {0xae5e0c9fe42e5e61ULL, 0x0127418f0d19ac28ULL, 0x9cf3d92c683fe127ULL, 0x972b602482e77228ULL}, {0x850481u, 0xc90682u, 0x850883u, 0x850a84u}},
+    {0x9d3e0c07b1a07e21ULL, {0xbb69c9b438fff9d6ULL, 0xd6d1c9fa7c4359b8ULL, 0x39556ae2a2a7fad8ULL, 0x27728092ccd31076ULL}, {0x8586a3u, 0x85c6c3u, 0x8606e3u, 0xaa4703u}},
+    {0x9ec8ad553e9ab5c8ULL, {0x96766f1530a9d47eULL, 0x33d8d905d3325cd9ULL, 0xa8b3aef11308974cULL, 0xae0825032037aa9eULL}, {0x8548a3u, 0x854aa4u, 0x858aa5u, 0xa98cc5u}},
+    {0xa46a6fc26cef4ef3ULL, {0x795aae4eefb6b5d6ULL, 0x3ff97d06925b32c2ULL, 0x94cf5d1b1624c424ULL, 0xbdab0fd934a5f6f4ULL}, {0x84c863u, 0x84ca64u, 0x84cc65u, 0x88ce66u}},
+    {0xa5c8807455f4ae4cULL, {0xa634d33799b3fccdULL, 0x68ada1bd48467ceaULL, 0x42d9c24b922f86e6ULL, 0xa3eb46345eb1648eULL}, {0x8604e2u, 0xca4502u, 0x868522u, 0x8584e2u}},
+    {0xa95908437f1d53f3ULL, {0x0b70470bfe48b561ULL, 0x95faec1df99c26bfULL, 0xd390c0607890f7c9ULL, 0xfe0039be459d19abULL}, {0xa986c2u, 0x8588c3u, 0x8582c2u, 0x858ac4u}},
+    {0xadeaf9276ffdec0eULL, {0x2dd804f18a6633dbULL, 0x03fa1ec3e88f860dULL, 0x2bcd206999a5d790ULL, 0x06ee76ae3631dfc9ULL}, {0x85c4e1u, 0x8584e2u, 0x8544c2u, 0x8504a2u}},
+    {0xafcf1fe5e778fe76ULL, {0x91d2aeb2eca74489ULL, 0xdd75ef49a8e8adfeULL, 0xefced57d0c90f922ULL, 0x878f34b7c468a4cdULL}, {0x850883u, 0xc90a84u, 0x850483u, 0x850c85u}},
+    {0xbbc4124200b50b61ULL, {0x92c9bd25b570221cULL, 0xecb1168cb4cc8e8fULL, 0xa11ec4a57d18f27cULL, 0x0d51b4d97ae2546dULL}, {0x8584e2u, 0x8544c2u, 0x8504a2u, 0x84c482u}},
+    {0xc90b4b028b2fa142ULL, {0xc8bcf39ae8e46d19ULL, 0x1e1ad9604827e53aULL, 0x7e9d5ce49981df63ULL, 0x470fa16270fcb1d0ULL}, {0x8602e1u, 0x864301u, 0x868321u, 0xeac341u}},
+    {0xcb012310cd2b8038ULL, {0x9b67b7efd111e474ULL, 0xea2c7d4bc36f2fbeULL, 0x5adbbcbc4d1f2011ULL, 0x1d300b89255025cdULL}, {0x850261u, 0x854281u, 0x8582a1u, 0xc980c1u}},
+    {0xd28fc6f83e3cc0cbULL, {0xb57f829e34b61cb6ULL, 0xe69c9df325d22972ULL, 0x67aa119a9974dff1ULL, 0xc3d65c7c69453b85ULL}, {0x8604e2u, 0x85c2e2u, 0x864502u, 0x85c6e2u}},
+    {0xd96412fcd391fc6dULL, {0xa4128a49a5609cd9ULL, 0x2e83d4167e01dfb3ULL, 0x3d387dc2773c3497ULL, 0x603384a6e9a4e33aULL}, {0x850261u, 0x854281u, 0x8582a1u, 0x85c2c1u}},
+    {0xdb81342fd83eb3ccULL, {0xcbd2abc3f11274daULL, 0x9ab1ff052975b00aULL, 0x70bfcd6655763b91ULL, 0x5bc766568479eb29ULL}, {0x8542a2u, 0x8504a2u, 0x850282u, 0x84c281u}},
+    {0xdd6e9f5c0dcab8ddULL, {0xe91dc2e0fe75e78dULL, 0x5e4ed5eb46ac59c1ULL, 0x1c901b22868fe394ULL, 0xc8938f9ed05e5c45ULL}, {0x848443u, 0x848242u, 0x84c241u, 0xe90261u}},
+    {0xe18f7d09ade99522ULL, {0x502bfdadf2a4dd9bULL, 0xa90cc0132213b85fULL, 0xa13f8f56ad7a3725ULL, 0xc1659aa3debb13d1ULL}, {0x854482u, 0x8584a2u, 0x85c4c2u, 0x8604e2u}},
+    {0xe71581dc06fb9459ULL, {0x879da3600256f01bULL, 0x47928a5863893353ULL, 0xfac520d01fe13c23ULL, 0xc127229ea32dfcfdULL}, {0x864341u, 0x8a0321u, 0x85c301u, 0x8582e1u}},
+    {0xeaae170fea9d5860ULL, {0xd33263862a114b5bULL, 0x2866bb25761fcb52ULL, 0x60e27df793446635ULL, 0xadd9a8aebbefba96ULL}, {0x854281u, 0x8582a1u, 0xc980c1u, 0x84c281u}},
+    {0xebe12c768810f909ULL, {0xdba313d377b88ef9ULL, 0x434e933bf8d79c7dULL, 0x43a476df3b076e8fULL, 0xbdf19018ec939922ULL}, {0x84c643u, 0x850663u, 0x854683u, 0xc986a3u}},
+    {0xeeb489ea69386955ULL, {0x237a33565f2c3f3fULL, 0xbf7c63538021fc34ULL, 0xf37901e4c5192b9dULL, 0xc3787da9ef9314deULL}, {0x848663u, 0x844643u, 0x844823u, 0x844a24u}},
+    {0xefb25bee0fbcd209ULL, {0xcce9d3a94c7aec59ULL, 0x2b8dfff637ffb281ULL, 0x63093924d2a41fe6ULL, 0x7f4fcdc35e15fa98ULL}, {0x8584c3u, 0x8582c2u, 0xc980c1u, 0x8546c3u}},
+    {0xf331388e9a43447dULL, {0x49f2e4df48a233e5ULL, 0xc9221634905f6bebULL, 0x473b127f81ab7c1aULL, 0xacb7eaf01350c505ULL}, {0x854281u, 0xe982a1u, 0x85c2c1u, 0x84c281u}},
+    {0xf8da27ebc4babbf0ULL, {0x9a65593ffedef2eeULL, 0x306930ea932a31adULL, 0xd732fb69b9d46064ULL, 0x69ff16a26f4a002dULL}, {0x8502a1u, 0xc982a1u, 0x84c281u, 0x848261u}},
+    {0xfc286659d45130ccULL, {0x3c9ac2a9a976bacaULL, 0x6a46b765adf18e0cULL, 0xf696247f73f3be4dULL, 0x494bb4c9e5d6b621ULL}, {0x844622u, 0x844823u, 0x844a24u, 0x844c25u}},
+};
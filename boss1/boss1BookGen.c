@@ -0,0 +1,112 @@
+#include "boss1Core.h"
+#include "boss1Sim.h"
+#include "boss1Duct.h"
+#include "boss1Map.h"
+#include "boss1Book.h"
+
+// Offline opening book generator: searches each start position far deeper than a turn
+// allows and writes the lines as boss1BookData.h, which boss1Book.h embeds.
+//
+//   gcc -O2 -o boss1BookGen boss1BookGen.c -lm
+//   ./boss1BookGen [-n generated] [-t ms] [-s seed] [-o boss1BookData.h] [maps...]
+//
+// Positions are the given ASCII maps (with 'R' and 'r' roots) plus -n point-symmetric
+// random ones. A line is keyed on the exact map (see boss1Book.h), so only maps that
+// will be played again are worth giving by name. On each of the first BOOK_TURNS turns the search picks our move and the
+// reply it expects from the opponent; both are played and the next turn is searched.
+
+#define BOOKGEN_MAX_LINES 4096
+
+// Function to search one start position into a book line
+static void book_line(Duct *duct, const GameState *gameState, double budget_ms, BookEntry *line) {
+    SimState s;
+    sim_load(&s, gameState);
+    line->map_hash = book_map_hash(&s.grid);
+    for (int t = 0; t < BOOK_TURNS; t++) {
+        line->state_hash[t] = book_state_hash(&s);
+        uint32_t mine = duct_search(duct, &s, budget_ms);
+        uint32_t theirs = duct_best(duct, OPP);
+        line->move[t] = book_pack(mine);
+        sim_apply_joint(&s, mine, theirs);
+        sim_end_turn(&s);
+    }
+}
+
+static int book_compare(const void *a, const void *b) {
+    uint64_t x = ((const BookEntry *)a)->map_hash, y = ((const BookEntry *)b)->map_hash;
+    return (x > y) - (x < y);
+}
+
+int main(int argc, char **argv) {
+    static GameState gameState;
+    static BookEntry lines[BOOKGEN_MAX_LINES];
+    static Duct duct;
+    int generated = 0, count = 0;
+    double budget_ms = 2000.0;
+    uint64_t rng = 0x5EED;
+    const char *output = "boss1BookData.h";
+
+    zobrist_init(1);
+    if (!duct_init(&duct, 12345)) {
+        return 1;
+    }
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            generated = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            budget_ms = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            rng = strtoull(argv[++i], NULL, 0) | 1;
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (count < BOOKGEN_MAX_LINES) {
+            if (!map_load_ascii(argv[i], &gameState)) {
+                return 1;
+            }
+            book_line(&duct, &gameState, budget_ms, &lines[count++]);
+            fprintf(stderr, "%s: line %d\n", argv[i], count);
+        }
+    }
+    for (int g = 0; g < generated && count < BOOKGEN_MAX_LINES; g++) {
+        map_random(&gameState, &rng);
+        book_line(&duct, &gameState, budget_ms, &lines[count++]);
+        fprintf(stderr, "generated map %d: line %d\n", g, count);
+    }
+
+    // Sorted for the binary search; the same map twice keeps its first line
+    qsort(lines, count, sizeof(lines[0]), book_compare);
+    int unique = 0;
+    for (int i = 0; i < count; i++) {
+        if (unique == 0 || lines[unique - 1].map_hash != lines[i].map_hash) {
+            lines[unique++] = lines[i];
+        }
+    }
+
+    FILE *out = fopen(output, "w");
+    if (out == NULL) {
+        perror(output);
+        return 1;
+    }
+    fprintf(out, "// Generated by boss1BookGen: %d lines, %.0f ms per search, %d turns each\n", unique, budget_ms, BOOK_TURNS);
+    fprintf(out, "#define BOOK_ENTRY_COUNT %d\n", unique);
+    if (unique > 0) {
+        fprintf(out, "static const BookEntry book_entries[BOOK_ENTRY_COUNT] = {\n");
+    }
+    for (int i = 0; i < unique; i++) {
+        fprintf(out, "    {0x%016llxULL, {", (unsigned long long)lines[i].map_hash);
+        for (int t = 0; t < BOOK_TURNS; t++) {
+            fprintf(out, "%s0x%016llxULL", t ? ", " : "", (unsigned long long)lines[i].state_hash[t]);
+        }
+        fprintf(out, "}, {");
+        for (int t = 0; t < BOOK_TURNS; t++) {
+            fprintf(out, "%s0x%06xu", t ? ", " : "", lines[i].move[t]);
+        }
+        fprintf(out, "}},\n");
+    }
+    if (unique > 0) {
+        fprintf(out, "};\n");
+    }
+    fclose(out);
+    printf("%d lines written to %s\n", unique, output);
+    return 0;
+}
@@ -0,0 +1,17 @@
+#include "boss1Strategies.h"
+
+// One bot binary for every strategy in boss1Strategies.h, all sharing the game loop of
+// boss1Strategy.h.
+//
+//   gcc -O2 -o boss1Bot boss1Bot.c -lm
+//   ./boss1Bot --strategy duct
+//   BOSS1_STRATEGY=greedy ./boss1Bot
+
+int main(int argc, char **argv) {
+    const Strategy *strategy = strategy_select(argc, argv);
+    if (strategy == NULL) {
+        return 2;
+    }
+    fprintf(stderr, "strategy %s\n", strategy->name);
+    return strategy_run(strategy);
+}
@@ -0,0 +1,278 @@
+#ifndef BOSS1_CHOKE_H
+#define BOSS1_CHOKE_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+#include "boss1Symmetry.h"
+
+// Chokepoint analysis of the open-cell graph (every cell that is not a wall or an
+// organ). Tarjan's articulation points give, for each cell, how many cells would be
+// cut off from the largest remaining area if that cell were taken, so the evaluator
+// can read the value of a cutoff move in O(1).
+//
+// choke_init() runs once per game on the static walls. On a symmetric map a component
+// whose image is another component is analyzed once and its labels copied through the
+// transform; a component that is its own image (the usual single open area of a
+// point-symmetric map) still needs the whole Tarjan pass. As organs fill cells,
+// choke_fill() floods the affected component to mark its cells stale; choke_refresh()
+// then reruns Tarjan from the stale cells alone. choke_sync() finds the changed cells
+// by comparing the grid with the one last seen eight cells at a time, so a turn costs
+// GRID_CELLS / 8 compares plus the size of the components that changed.
+
+#define CHOKE_UNLABELED -1
+
+typedef struct {
+    Bitboard open;                    // cells the analysis still treats as passable
+    Bitboard articulation;            // open cells whose removal splits their component
+    int16_t cut_area[GRID_CELLS];     // cells separated from the largest remaining part if taken
+    int16_t comp[GRID_CELLS];         // component id of each open cell
+    int16_t next_comp;
+    Bitboard stale;                   // cells to relabel on the next refresh
+    uint8_t seen[GRID_CELLS];         // the grid as last synced
+    Symmetry sym;                     // of the walls choke_init() saw
+} ChokeMap;
+
+/* #############  TARJAN ##################################################### */
+
+// Function to label one component from root and fill cut_area/articulation for its
+// cells, with an explicit stack so large open maps cannot overflow the call stack;
+// order receives the component's cells and the count is returned
+static int choke_tarjan(ChokeMap *ch, int root, int16_t comp_id, int16_t *order) {
+    static int16_t disc[GRID_CELLS], low[GRID_CELLS], size[GRID_CELLS], parent[GRID_CELLS];
+    static int16_t sep_sum[GRID_CELLS], sep_max[GRID_CELLS];
+    static int16_t stack[GRID_CELLS];
+    static uint8_t next_dir[GRID_CELLS];
+    int top = 0, count = 0, root_children = 0;
+
+    ch->comp[root] = comp_id;
+    disc[root] = low[root] = 0;
+    size[root] = 1;
+    parent[root] = -1;
+    sep_sum[root] = sep_max[root] = 0;
+    next_dir[root] = 0;
+    stack[top++] = (int16_t)root;
+    order[count++] = (int16_t)root;
+
+    while (top > 0) {
+        int u = stack[top - 1];
+        if (next_dir[u] < 4) {
+            int v = grid_nb[u][next_dir[u]++];
+            if (!bb_test(&ch->open, v)) {
+                continue;
+            }
+            if (ch->comp[v] != comp_id) { // tree edge: first visit
+                ch->comp[v] = comp_id;
+                disc[v] = low[v] = (int16_t)count;
+                size[v] = 1;
+                parent[v] = (int16_t)u;
+                sep_sum[v] = sep_max[v] = 0;
+                next_dir[v] = 0;
+                stack[top++] = (int16_t)v;
+                order[count++] = (int16_t)v;
+            } else if (v != parent[u] && disc[v] < low[u]) { // back edge
+                low[u] = disc[v];
+            }
+            continue;
+        }
+
+        // u is finished: fold it into its parent
+        top--;
+        int p = parent[u];
+        if (p < 0) {
+            continue;
+        }
+        size[p] += size[u];
+        if (low[u] < low[p]) {
+            low[p] = low[u];
+        }
+        if (p == root) {
+            root_children++;
+        }
+        if (low[u] >= disc[p]) { // u's subtree only reaches the rest through p
+            sep_sum[p] += size[u];
+            if (size[u] > sep_max[p]) {
+                sep_max[p] = size[u];
+            }
+        }
+    }
+
+    // Every removal leaves count - 1 cells; whatever is not in the largest piece is cut off
+    for (int i = 0; i < count; i++) {
+        int u = order[i];
+        int rest = (u == root) ? 0 : count - 1 - sep_sum[u];
+        bool is_cut = (u == root) ? root_children > 1 : sep_sum[u] > 0;
+        int largest = sep_max[u] > rest ? sep_max[u] : rest;
+        ch->cut_area[u] = (int16_t)(is_cut ? count - 1 - largest : 0);
+        if (is_cut) {
+            bb_set(&ch->articulation, u);
+        } else {
+            bb_reset(&ch->articulation, u);
+        }
+    }
+    return count;
+}
+
+/* ################################################################################# */
+
+/* #############  UPDATES #################################################### */
+
+// Function to relabel the stale cells; the component ids run out after 30000
+// relabels, and then every open cell is relabeled once
+void choke_refresh(ChokeMap *ch) {
+    static int16_t order[GRID_CELLS];
+    if (ch->next_comp > 30000) {
+        for (int idx = 0; idx < GRID_CELLS; idx++) {
+            ch->comp[idx] = CHOKE_UNLABELED;
+        }
+        bb_clear(&ch->articulation);
+        memset(ch->cut_area, 0, sizeof(ch->cut_area));
+        ch->stale = ch->open;
+        ch->next_comp = 0;
+    }
+    BB_FOREACH(&ch->stale, idx) {
+        if (bb_test(&ch->open, idx) && ch->comp[idx] == CHOKE_UNLABELED) {
+            choke_tarjan(ch, idx, ch->next_comp++, order);
+        }
+    }
+    bb_clear(&ch->stale);
+}
+
+// Function to mark the component holding seed stale: its cells are flooded through
+// their component id, so the cost is the size of that component
+static void choke_mark_stale(ChokeMap *ch, int seed) {
+    static int16_t queue[GRID_CELLS];
+    int16_t comp_id = ch->comp[seed];
+    if (comp_id == CHOKE_UNLABELED) {
+        return;
+    }
+    int front = 0, rear = 0;
+    ch->comp[seed] = CHOKE_UNLABELED;
+    bb_set(&ch->stale, seed);
+    queue[rear++] = (int16_t)seed;
+    while (front < rear) {
+        int u = queue[front++];
+        for (int d = 0; d < 4; d++) {
+            int v = grid_nb[u][d];
+            if (ch->comp[v] == comp_id) {
+                ch->comp[v] = CHOKE_UNLABELED;
+                bb_set(&ch->stale, v);
+                queue[rear++] = (int16_t)v;
+            }
+        }
+    }
+}
+
+// Function to build the analysis from the static walls, once per game; with use_sym
+// false every component is analyzed even on a symmetric map (the bench's reference)
+void choke_init_with(ChokeMap *ch, const Grid *grid, bool use_sym) {
+    static int16_t order[GRID_CELLS];
+    memset(ch, 0, sizeof(*ch));
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        ch->comp[idx] = CHOKE_UNLABELED;
+        ch->seen[idx] = grid->piece[idx] == PIECE_WALL ? PIECE_WALL : PIECE_EMPTY;
+        if (grid->piece[idx] != PIECE_WALL) {
+            bb_set(&ch->open, idx);
+        }
+    }
+    if (use_sym) {
+        symmetry_detect(&ch->sym, grid);
+    } else {
+        sym_fill(&ch->sym, SYM_NONE, grid->width, grid->height);
+    }
+    BB_FOREACH(&ch->open, idx) {
+        if (ch->comp[idx] != CHOKE_UNLABELED) {
+            continue;
+        }
+        int count = choke_tarjan(ch, idx, ch->next_comp++, order);
+        if (ch->comp[sym_cell(&ch->sym, idx)] != CHOKE_UNLABELED) {
+            continue; // the component is its own image (always so without a symmetry)
+        }
+        // The image component mirrors this one cell for cell
+        int16_t image_id = ch->next_comp++;
+        for (int i = 0; i < count; i++) {
+            int u = order[i], v = sym_cell(&ch->sym, u);
+            ch->comp[v] = image_id;
+            ch->cut_area[v] = ch->cut_area[u];
+            if (bb_test(&ch->articulation, u)) {
+                bb_set(&ch->articulation, v);
+            }
+        }
+    }
+}
+
+static inline void choke_init(ChokeMap *ch, const Grid *grid) { choke_init_with(ch, grid, true); }
+
+// Function to record that a cell was taken (an organ grew there)
+void choke_fill(ChokeMap *ch, int idx) {
+    if (!bb_test(&ch->open, idx)) {
+        return;
+    }
+    bb_reset(&ch->open, idx);
+    bb_reset(&ch->articulation, idx);
+    ch->cut_area[idx] = 0;
+    choke_mark_stale(ch, idx);
+}
+
+// Function to record that a cell became passable again (an organ died); it may join
+// several components, so all of its neighbors' components are relabeled
+void choke_free(ChokeMap *ch, int idx) {
+    if (bb_test(&ch->open, idx)) {
+        return;
+    }
+    bb_set(&ch->open, idx);
+    ch->comp[idx] = CHOKE_UNLABELED;
+    bb_set(&ch->stale, idx);
+    for (int d = 0; d < 4; d++) {
+        choke_mark_stale(ch, grid_nb[idx][d]);
+    }
+}
+
+// Function to bring the analysis in line with this turn's grid: walls and organs are
+// filled, everything else is open, so a grid from another map needs no new choke_init().
+// Only the blocks of eight cells that differ from the grid last synced are visited.
+void choke_sync(ChokeMap *ch, const Grid *grid) {
+    for (int base = 0; base < GRID_CELLS; base += 8) {
+        if (base + 8 <= GRID_CELLS) {
+            uint64_t seen, piece;
+            memcpy(&seen, &ch->seen[base], sizeof(seen));
+            memcpy(&piece, &grid->piece[base], sizeof(piece));
+            if (seen == piece) {
+                continue;
+            }
+        }
+        for (int idx = base; idx < base + 8 && idx < GRID_CELLS; idx++) {
+            int piece = grid->piece[idx];
+            if (piece_is_organ(piece) || piece == PIECE_WALL) {
+                choke_fill(ch, idx);
+            } else {
+                choke_free(ch, idx);
+            }
+            ch->seen[idx] = (uint8_t)piece;
+        }
+    }
+    choke_refresh(ch);
+}
+
+/* ################################################################################# */
+
+/* #############  QUERIES #################################################### */
+
+// Cells that would be cut off from the largest remaining area by taking idx, in O(1)
+static inline int choke_cut_area(const ChokeMap *ch, int idx) { return ch->cut_area[idx]; }
+static inline bool choke_is_articulation(const ChokeMap *ch, int idx) { return bb_test(&ch->articulation, idx); }
+
+// Function to print the chokepoints with the area behind each one
+void choke_print(const ChokeMap *ch, FILE *out) {
+    BB_FOREACH(&ch->articulation, idx) {
+        fprintf(out, "choke (%d, %d) cuts off %d cells\n", grid_x(idx), grid_y(idx), ch->cut_area[idx]);
+    }
+}
+
+/* ################################################################################# */
+
+#endif
@@ -0,0 +1,476 @@
+#ifndef BOSS1_CORE_H
+#define BOSS1_CORE_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <time.h>
+
+// Shared header-only core of the boss1 bots: game state parsing, the map printer,
+// a fixed-size grid, bitboards and BFS. Sizes are compile-time maxima instead of
+// runtime VLAs, so cell indexing uses a constant stride and the four-direction
+// loops unroll. Build with -DGRID_MAX_W=.. -DGRID_MAX_H=.. to specialise a binary
+// for a smaller league map.
+//
+// The grid is stored with a one-cell wall border and a precomputed neighbor table,
+// so walking to a neighbor never needs a bounds check: off-map cells are walls.
+//
+// Cells are numbered row by row. Build with -DGRID_LAYOUT_MORTON to number them in
+// Z-order instead (the bits of the padded x and y interleaved), which keeps vertical
+// neighbors close in memory at the price of a few holes in the index range; the
+// holes are walls like the border. Code that goes through grid_index()/grid_x()/
+// grid_y()/grid_nb works unchanged under either layout.
+
+#ifndef GRID_MAX_W
+#define GRID_MAX_W 24             // largest arena map is 24 x 12
+#endif
+#ifndef GRID_MAX_H
+#define GRID_MAX_H 12
+#endif
+#define GRID_STRIDE (GRID_MAX_W + 2)  // row length including the wall border
+#ifdef GRID_LAYOUT_MORTON
+// Bits 0..4 of v moved to the even positions 0..8
+#define MORTON_SPREAD(v) (((v) & 1) | ((v) & 2) << 1 | ((v) & 4) << 2 | ((v) & 8) << 3 | ((v) & 16) << 4)
+#define GRID_CELLS ((MORTON_SPREAD(GRID_STRIDE - 1) | MORTON_SPREAD(GRID_MAX_H + 1) << 1) + 1)
+_Static_assert(GRID_STRIDE <= 32 && GRID_MAX_H + 2 <= 32, "MORTON_SPREAD covers 5 bits of each padded coordinate");
+#else
+#define GRID_CELLS (GRID_STRIDE * (GRID_MAX_H + 2))
+#endif
+#define MAX_ENTITIES (GRID_MAX_W * GRID_MAX_H) // at most one entity per cell
+
+// Define short entity type representations (a bot may define its own before including)
+#ifndef WALL
+#define WALL '#'
+#endif
+#ifndef ROOT
+#define ROOT 'R'
+#endif
+#ifndef BASIC
+#define BASIC 'B'
+#endif
+#ifndef A_PROTEIN
+#define A_PROTEIN 'A'
+#endif
+#ifndef EMPTY
+#define EMPTY 'E'
+#endif
+
+#define ME 1                      // owner values as sent by the referee
+#define OPP 0
+
+typedef struct {
+    int x;
+    int y;
+} Point;
+
+typedef struct {
+    int x;                        // grid coordinate x
+    int y;                        // grid coordinate y
+    char type[33];                // type of the entity
+    int owner;                    // 1 if your organ, 0 if enemy organ, -1 if neither
+    int organ_id;                 // id of this entity if it's an organ, 0 otherwise
+    char organ_dir[2];            // N, E, S, W or X if not an organ
+    int organ_parent_id;          // parent id of the organ
+    int organ_root_id;            // root id of the organ
+} Entity;
+
+typedef struct {
+    int width;                    // columns in the game grid
+    int height;                   // rows in the game grid
+    int entity_count;             // number of entities in the game
+    Entity entities[MAX_ENTITIES];
+    int my_proteins[4];           // your protein stock: myA, myB, myC, myD
+    int opp_proteins[4];          // opponent's protein stock: oppA, oppB, oppC, oppD
+    int required_actions_count;   // your number of organisms, output an action for each one in any order
+} GameState;
+
+/* #############  INPUT ###################################################### */
+
+// Function to read the first line of the game input
+static inline bool read_grid_size(FILE *in, GameState *gameState) {
+    return fscanf(in, "%d%d", &gameState->width, &gameState->height) == 2
+        && gameState->width > 0 && gameState->width <= GRID_MAX_W
+        && gameState->height > 0 && gameState->height <= GRID_MAX_H;
+}
+
+// Function to read one turn of input; returns false at end of input, and on an entity
+// outside the width x height read by read_grid_size(), which every grid index assumes
+static inline bool read_turn(FILE *in, GameState *gameState) {
+    if (fscanf(in, "%d", &gameState->entity_count) != 1 || gameState->entity_count < 0
+        || gameState->entity_count > MAX_ENTITIES) {
+        return false;
+    }
+    for (int i = 0; i < gameState->entity_count; i++) {
+        Entity *e = &gameState->entities[i];
+        if (fscanf(in, "%d%d%32s%d%d%1s%d%d", &e->x, &e->y, e->type, &e->owner, &e->organ_id,
+                   e->organ_dir, &e->organ_parent_id, &e->organ_root_id) != 8
+            || e->x < 0 || e->x >= gameState->width || e->y < 0 || e->y >= gameState->height) {
+            return false;
+        }
+    }
+    return fscanf(in, "%d%d%d%d", &gameState->my_proteins[0], &gameState->my_proteins[1],
+                  &gameState->my_proteins[2], &gameState->my_proteins[3]) == 4
+        && fscanf(in, "%d%d%d%d", &gameState->opp_proteins[0], &gameState->opp_proteins[1],
+                  &gameState->opp_proteins[2], &gameState->opp_proteins[3]) == 4
+        && fscanf(in, "%d", &gameState->required_actions_count) == 1;
+}
+
+// Function to write the first line of the game input, as the referee sends it
+static inline void write_grid_size(FILE *out, const GameState *gameState) {
+    fprintf(out, "%d %d\n", gameState->width, gameState->height);
+}
+
+// Function to write one turn in the referee's input format, the inverse of read_turn()
+static inline void write_turn(FILE *out, const GameState *gameState) {
+    fprintf(out, "%d\n", gameState->entity_count);
+    for (int i = 0; i < gameState->entity_count; i++) {
+        const Entity *e = &gameState->entities[i];
+        fprintf(out, "%d %d %s %d %d %s %d %d\n", e->x, e->y, e->type, e->owner, e->organ_id,
+                e->organ_dir, e->organ_parent_id, e->organ_root_id);
+    }
+    fprintf(out, "%d %d %d %d\n", gameState->my_proteins[0], gameState->my_proteins[1],
+            gameState->my_proteins[2], gameState->my_proteins[3]);
+    fprintf(out, "%d %d %d %d\n", gameState->opp_proteins[0], gameState->opp_proteins[1],
+            gameState->opp_proteins[2], gameState->opp_proteins[3]);
+    fprintf(out, "%d\n", gameState->required_actions_count);
+}
+
+/* ################################################################################# */
+
+/* #############  STATS ###################################################### */
+
+// Work counters read by the replay harness to enforce per-turn node budgets
+typedef struct {
+    uint64_t nodes_expanded;          // cells dequeued by the searches
+} SearchStats;
+
+static SearchStats search_stats;
+
+/* ################################################################################# */
+
+/* #############  OUTPUT ##################################################### */
+
+// Every action line goes through emit_action() so it can be captured: action_stream
+// redirects it (stdout by default) and action_hook sees each line, e.g. for the game log
+static FILE *action_stream;
+static void (*action_hook)(const char *line);
+
+static inline void emit_action(const char *format, ...) {
+    char line[128];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    fputs(line, action_stream ? action_stream : stdout);
+    if (action_hook) {
+        action_hook(line);
+    }
+}
+
+/* ################################################################################# */
+
+/* #############  PRINT_MAP ################################################### */
+
+// Function to check if a point is within the grid bounds
+static inline bool is_within_bounds(int x, int y, GameState *gameState) {
+    return (x >= 0 && x < gameState->width && y >= 0 && y < gameState->height);
+}
+
+// Function to print the current state of the game map
+static inline void print_map(GameState *gameState) {
+    char grid[GRID_MAX_H][GRID_MAX_W];
+
+    // Initialize the grid with empty spaces
+    memset(grid, EMPTY, sizeof(grid));
+
+    // Place entities on the grid
+    for (int i = 0; i < gameState->entity_count; i++) {
+        int x = gameState->entities[i].x;
+        int y = gameState->entities[i].y;
+        if (is_within_bounds(x, y, gameState)) {
+            if (strcmp(gameState->entities[i].type, "WALL") == 0) {
+                grid[y][x] = WALL; // Represent WALL
+            } else if (strcmp(gameState->entities[i].type, "ROOT") == 0) {
+                grid[y][x] = ROOT; // Represent ROOT
+            } else if (strcmp(gameState->entities[i].type, "BASIC") == 0) {
+                grid[y][x] = BASIC; // Represent BASIC
+            } else if (strcmp(gameState->entities[i].type, "A") == 0) {
+                grid[y][x] = A_PROTEIN; // Represent A protein source
+            }
+        }
+    }
+
+    // Print the grid to stderr
+    for (int i = 0; i < gameState->height; i++) {
+        for (int j = 0; j < gameState->width; j++) {
+            fprintf(stderr, "%c ", grid[i][j]);
+        }
+        fprintf(stderr, "\n");
+    }
+    fprintf(stderr, "\n");
+}
+
+/* ################################################################################# */
+
+/* #############  TIMING ################################################### */
+
+// Function to read a monotonic clock in milliseconds
+static inline double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+/* ################################################################################# */
+
+/* #############  DIRECTIONS ################################################# */
+
+// Directions N, E, S, W as (dx, dy) and as cell index offsets
+static const int dir_dx[4] = {0, 1, 0, -1};
+static const int dir_dy[4] = {-1, 0, 1, 0};
+#ifndef GRID_LAYOUT_MORTON
+static const int dir_offset[4] = {-GRID_STRIDE, 1, GRID_STRIDE, -1};
+#endif
+static const char dir_chars[4] = {'N', 'E', 'S', 'W'};
+
+#define DIR_OPPOSITE(d) ((d) ^ 2)
+
+// Function to map a referee direction letter to 0..3, defaulting to N for 'X'
+static inline int dir_from_char(char c) {
+    for (int d = 0; d < 4; d++) {
+        if (dir_chars[d] == c) {
+            return d;
+        }
+    }
+    return 0;
+}
+
+/* ################################################################################# */
+
+/* #############  GRID ####################################################### */
+
+// Piece codes: what occupies a cell (also the Zobrist piece index)
+#define PIECE_EMPTY 0
+#define PIECE_WALL 1
+#define PIECE_PROTEIN 2           // + protein type (0..3 for A..D)
+#define PIECE_ORGAN 6             // + owner * 20 + organ type * 4 + dir
+#define PIECE_COUNT 46
+
+enum { ORGAN_ROOT, ORGAN_BASIC, ORGAN_HARVESTER, ORGAN_TENTACLE, ORGAN_SPORER, ORGAN_TYPES };
+
+// Protein cost of each organ type: A, B, C, D
+static const int organ_cost[ORGAN_TYPES][4] = {
+    {1, 1, 1, 1}, // ROOT
+    {1, 0, 0, 0}, // BASIC
+    {0, 0, 1, 1}, // HARVESTER
+    {0, 1, 1, 0}, // TENTACLE
+    {0, 1, 0, 1}, // SPORER
+};
+static const char *organ_names[ORGAN_TYPES] = {"ROOT", "BASIC", "HARVESTER", "TENTACLE", "SPORER"};
+
+static inline bool piece_is_organ(int piece) { return piece >= PIECE_ORGAN; }
+static inline bool piece_is_protein(int piece) { return piece >= PIECE_PROTEIN && piece < PIECE_ORGAN; }
+static inline bool piece_is_free(int piece) { return piece == PIECE_EMPTY || piece_is_protein(piece); }
+static inline int piece_owner(int piece) { return (piece - PIECE_ORGAN) / 20; }
+static inline int piece_organ_type(int piece) { return ((piece - PIECE_ORGAN) % 20) / 4; }
+static inline int piece_dir(int piece) { return (piece - PIECE_ORGAN) % 4; }
+static inline int organ_piece(int owner, int type, int dir) { return PIECE_ORGAN + owner * 20 + type * 4 + dir; }
+
+typedef struct {
+    int width;
+    int height;
+    uint8_t piece[GRID_CELLS];        // PIECE_* code of each cell; the border and cells off the map are walls
+    int16_t organ_id[GRID_CELLS];     // organ id for organ pieces, 0 otherwise
+} Grid;
+
+#ifdef GRID_LAYOUT_MORTON
+// Function to gather the even bits 0..8 of v back into bits 0..4
+static inline int morton_compact(int v) {
+    return (v & 1) | (v >> 1 & 2) | (v >> 2 & 4) | (v >> 3 & 8) | (v >> 4 & 16);
+}
+static inline int grid_index(int x, int y) { return MORTON_SPREAD(x + 1) | MORTON_SPREAD(y + 1) << 1; }
+static inline int grid_x(int idx) { return morton_compact(idx) - 1; }
+static inline int grid_y(int idx) { return morton_compact(idx >> 1) - 1; }
+#else
+static inline int grid_index(int x, int y) { return (y + 1) * GRID_STRIDE + (x + 1); }
+static inline int grid_x(int idx) { return idx % GRID_STRIDE - 1; }
+static inline int grid_y(int idx) { return idx / GRID_STRIDE - 1; }
+#endif
+
+// Neighbor index of every cell in each direction. Border cells (and the holes of the
+// Morton layout) point at themselves, so a walk can never leave the array.
+static int16_t grid_nb[GRID_CELLS][4];
+
+static inline void grid_init_neighbors(void) {
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        int x = grid_x(idx);
+        int y = grid_y(idx);
+        bool border = x < 0 || y < 0 || x >= GRID_MAX_W || y >= GRID_MAX_H;
+        for (int d = 0; d < 4; d++) {
+            grid_nb[idx][d] = (int16_t)(border ? idx : grid_index(x + dir_dx[d], y + dir_dy[d]));
+        }
+    }
+}
+
+// Function to return the neighbor cell index in direction d; no bounds check is
+// needed because the border is walls and walls are never expanded
+static inline int grid_neighbor(const Grid *g, int idx, int d) {
+    (void)g;
+    return grid_nb[idx][d];
+}
+
+// Function to translate one entity into its piece code
+static inline int piece_from_entity(const Entity *e) {
+    if (strcmp(e->type, "WALL") == 0) {
+        return PIECE_WALL;
+    }
+    if (e->type[0] >= 'A' && e->type[0] <= 'D' && e->type[1] == '\0') {
+        return PIECE_PROTEIN + (e->type[0] - 'A');
+    }
+    for (int t = 0; t < ORGAN_TYPES; t++) {
+        if (strcmp(e->type, organ_names[t]) == 0 && (e->owner == ME || e->owner == OPP)) {
+            return organ_piece(e->owner, t, dir_from_char(e->organ_dir[0]));
+        }
+    }
+    return PIECE_EMPTY;
+}
+
+// Function to reset the grid to an empty width x height map inside its wall border
+static inline void grid_clear(Grid *g, int width, int height) {
+    static bool neighbors_ready = false;
+    if (!neighbors_ready) {
+        grid_init_neighbors();
+        neighbors_ready = true;
+    }
+    g->width = width;
+    g->height = height;
+    memset(g->organ_id, 0, sizeof(g->organ_id));
+    memset(g->piece, PIECE_WALL, sizeof(g->piece));
+    for (int y = 0; y < height; y++) {
+#ifdef GRID_LAYOUT_MORTON
+        for (int x = 0; x < width; x++) {
+            g->piece[grid_index(x, y)] = PIECE_EMPTY;
+        }
+#else
+        memset(&g->piece[grid_index(0, y)], PIECE_EMPTY, width);
+#endif
+    }
+}
+
+// Function to build the grid from the parsed turn (the adapter from the C game loop)
+static inline void grid_from_state(Grid *g, const GameState *gameState) {
+    grid_clear(g, gameState->width, gameState->height);
+    for (int i = 0; i < gameState->entity_count; i++) {
+        const Entity *e = &gameState->entities[i];
+        int idx = grid_index(e->x, e->y);
+        g->piece[idx] = (uint8_t)piece_from_entity(e);
+        g->organ_id[idx] = (int16_t)e->organ_id;
+    }
+}
+
+/* ################################################################################# */
+
+/* #############  BITBOARD ################################################### */
+
+#define BB_WORDS ((GRID_CELLS + 63) / 64)
+
+typedef struct {
+    uint64_t w[BB_WORDS];
+} Bitboard;
+
+static inline void bb_clear(Bitboard *b) { memset(b, 0, sizeof(*b)); }
+static inline void bb_set(Bitboard *b, int idx) { b->w[idx >> 6] |= 1ULL << (idx & 63); }
+static inline void bb_reset(Bitboard *b, int idx) { b->w[idx >> 6] &= ~(1ULL << (idx & 63)); }
+static inline bool bb_test(const Bitboard *b, int idx) { return (b->w[idx >> 6] >> (idx & 63)) & 1; }
+
+static inline int bb_count(const Bitboard *b) {
+    int n = 0;
+    for (int i = 0; i < BB_WORDS; i++) {
+        n += __builtin_popcountll(b->w[i]);
+    }
+    return n;
+}
+
+static inline void bb_or(Bitboard *dst, const Bitboard *src) {
+    for (int i = 0; i < BB_WORDS; i++) {
+        dst->w[i] |= src->w[i];
+    }
+}
+
+static inline void bb_andnot(Bitboard *dst, const Bitboard *src) {
+    for (int i = 0; i < BB_WORDS; i++) {
+        dst->w[i] &= ~src->w[i];
+    }
+}
+
+// Iterate over the set cells of a bitboard in index order
+#define BB_FOREACH(bb, idx) \
+    for (int bb_w_ = 0; bb_w_ < BB_WORDS; bb_w_++) \
+        for (uint64_t bb_m_ = (bb)->w[bb_w_]; bb_m_; bb_m_ &= bb_m_ - 1) \
+            for (int idx = bb_w_ * 64 + __builtin_ctzll(bb_m_), bb_once_ = 1; bb_once_; bb_once_ = 0)
+
+// Function to collect the cells of the grid whose piece satisfies a predicate
+static inline void bb_from_grid(Bitboard *b, const Grid *g, bool (*pred)(int piece)) {
+    bb_clear(b);
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        if (pred(g->piece[idx])) {
+            bb_set(b, idx);
+        }
+    }
+}
+
+/* ################################################################################# */
+
+/* #############  BFS ######################################################## */
+
+// Visited marks that never need clearing: a cell is visited when its mark equals the
+// current epoch, and starting a new search just bumps the epoch
+typedef struct {
+    uint32_t mark[GRID_CELLS];
+    uint32_t epoch;
+} VisitMarks;
+
+static inline void visit_begin(VisitMarks *v) {
+    if (++v->epoch == 0) { // wrapped after 4 billion searches: clear once and restart
+        memset(v->mark, 0, sizeof(v->mark));
+        v->epoch = 1;
+    }
+}
+static inline bool visit_seen(const VisitMarks *v, int idx) { return v->mark[idx] == v->epoch; }
+static inline void visit_set(VisitMarks *v, int idx) { v->mark[idx] = v->epoch; }
+
+// Function to run a BFS from one or more source cells through free cells (empty or
+// protein). dist[] receives the step count per cell, -1 where unreached. Returns the
+// number of cells reached.
+static inline int grid_bfs(const Grid *g, const int *sources, int source_count, int16_t dist[GRID_CELLS]) {
+    static int queue[GRID_CELLS];
+    int front = 0, rear = 0;
+
+    memset(dist, -1, sizeof(int16_t) * GRID_CELLS);
+    for (int i = 0; i < source_count; i++) {
+        if (dist[sources[i]] < 0) {
+            dist[sources[i]] = 0;
+            queue[rear++] = sources[i];
+        }
+    }
+
+    while (front < rear) {
+        int current = queue[front++];
+        search_stats.nodes_expanded++;
+        for (int d = 0; d < 4; d++) {
+            int next = grid_neighbor(g, current, d);
+            if (dist[next] < 0 && piece_is_free(g->piece[next])) {
+                dist[next] = (int16_t)(dist[current] + 1);
+                queue[rear++] = next;
+            }
+        }
+    }
+    return rear;
+}
+
+/* ################################################################################# */
+
+#endif
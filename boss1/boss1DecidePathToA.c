@@ -1,145 +1,74 @@
-#include <stdlib.h>
-#include <stdio.h>
-#include <string.h>
-#include <stdbool.h>
-
+// Local map legend, picked up by print_map() in the core
 #define WALL 'W'
-#define ROOT 'R'
-#define BASIC 'B'
-#define A_PROTEIN 'A'
 #define EMPTY '.'
 
-typedef struct {
-    int x;
-    int y;
-} Point;
-
-typedef struct {
-    int width;                // columns in the game grid
-    int height;               // rows in the game grid
-    int entity_count;         // number of entities in the game
-    struct {
-        int x;                // grid coordinate x
-        int y;                // grid coordinate y
-        char type[33];        // type of the entity
-        int owner;            // 1 if your organ, 0 if enemy organ, -1 if neither
-        int organ_id;         // id of this entity if it's an organ, 0 otherwise
-        char organ_dir[2];    // N, E, S, W or X if not an organ
-        int organ_parent_id;   // parent id of the organ
-        int organ_root_id;     // root id of the organ
-    } entities[100];          // assuming a maximum of 100 entities
-    int my_proteins[4];       // your protein stock: myA, myB, myC, myD
-    int opp_proteins[4];      // opponent's protein stock: oppA, oppB, oppC, oppD
-    int required_actions_count; // your number of organisms, output an action for each one in any order
-} GameState;
-
-/* #############  PRINT_MAP ################################################### */
-
-// Function to print the current state of the game map
-void print_map(GameState *gameState) {
-    char grid[gameState->height][gameState->width];
-
-    // Initialize the grid with empty spaces
-    for (int i = 0; i < gameState->height; i++) {
-        for (int j = 0; j < gameState->width; j++) {
-            grid[i][j] = EMPTY; // Default empty space
-        }
-    }
-
-    // Place entities on the grid
-    for (int i = 0; i < gameState->entity_count; i++) {
-        int x = gameState->entities[i].x;
-        int y = gameState->entities[i].y;
-        if (x >= 0 && x < gameState->width && y >= 0 && y < gameState->height) {
-            if (strcmp(gameState->entities[i].type, "WALL") == 0) {
-                grid[y][x] = WALL; // Represent WALL
-            } else if (strcmp(gameState->entities[i].type, "ROOT") == 0) {
-                grid[y][x] = ROOT; // Represent ROOT
-            } else if (strcmp(gameState->entities[i].type, "BASIC") == 0) {
-                grid[y][x] = BASIC; // Represent BASIC
-            } else if (strcmp(gameState->entities[i].type, "A") == 0) {
-                grid[y][x] = A_PROTEIN; // Represent A protein source
-            }
-        }
-    }
-
-    // Print the grid to stderr
-    for (int i = 0; i < gameState->height; i++) {
-        for (int j = 0; j < gameState->width; j++) {
-            fprintf(stderr, "%c ", grid[i][j]);
-        }
-        fprintf(stderr, "\n");
-    }
-    fprintf(stderr, "\n");
-}
-
-/* ################################################################################# */
-
-// Directions for moving in the grid (N, E, S, W)
-int directions[4][2] = {{-1, 0}, {0, 1}, {1, 0}, {0, -1}};
-char direction_chars[4] = {'N', 'E', 'S', 'W'};
-
-// Function to check if a point is within the grid bounds
-bool is_within_bounds(int x, int y, GameState *gameState) {
-    return (x >= 0 && x < gameState->width && y >= 0 && y < gameState->height);
+#include "boss1Core.h"
+#include "boss1Log.h"
+#include "boss1Organism.h"
+#include "boss1DistField.h"
+#include "boss1Rays.h"
+#include "boss1Harvest.h"
+#include "boss1Threat.h"
+#include "boss1Perf.h"
+#include "boss1PathTree.h"
+#include "boss1Params.h"
+#include "boss1Strategy.h"
+
+#define TURN_DEADLINE_MS 40.0         // of the referee's 50 ms, shared by the organisms' harvester plans
+
+// The bot's parameters (BOSS1_PARAMS), and the order in which the A search expands
+// neighbors, decoded from them; path_to_a_use() sets both
+static Params path_params;
+static int search_order[4];
+static int path_last_turn = -1;       // turn of the previous decision, -1 at the start of a game
+
+// Function to make the bot play with a parameter vector
+void path_to_a_use(const Params *p) {
+    path_params = *p;
+    params_dir_order(p->v[PARAM_search_order], search_order);
 }
 
 // Function to print the GROW command
 void print_grow_command(int parent_id, int x, int y) {
-    printf("GROW %d %d %d BASIC\n", parent_id, x, y);
+    emit_action("GROW %d %d %d BASIC\n", parent_id, x, y);
 }
 
-// Function to find the A protein source using BFS and return the path
-Point find_a_protein(GameState *gameState, int start_x, int start_y, Point parent[][gameState->width]) {
-    // Queue for BFS
-    Point queue[1000]; // Assuming a maximum of 1000 points in the queue
+// Function to find the A protein source using BFS and return the path.
+// tree receives, for each reached cell, the direction it was entered from; it is only
+// meaningful along the returned path, so it never needs clearing either.
+Point find_a_protein(const Grid *grid, int start_x, int start_y, PathTree *tree) {
+    // Queue for BFS, sized for every cell of the largest map
+    static int queue[GRID_CELLS];
     int front = 0, rear = 0;
 
-    // Visited array to keep track of visited positions
-    bool visited[gameState->height][gameState->width];
-    memset(visited, false, sizeof(visited));
+    // Epoch visited marks: starting a search bumps the epoch instead of clearing an array
+    static VisitMarks visited;
+    visit_begin(&visited);
 
     // Start from the initial position
-    queue[rear++] = (Point){start_x, start_y};
-    visited[start_y][start_x] = true;
-
-    // Initialize parent array
-    memset(parent, -1, sizeof(Point) * gameState->height * gameState->width);
+    int start = grid_index(start_x, start_y);
+    queue[rear++] = start;
+    visit_set(&visited, start);
+    path_tree_begin(tree, start);
 
     while (front < rear) {
-        Point current = queue[front++];
+        int current = queue[front++];
+        search_stats.nodes_expanded++;
 
         // Check if the current position is an A protein source
-        for (int i = 0; i < gameState->entity_count; i++) {
-            if (gameState->entities[i].x == current.x && gameState->entities[i].y == current.y &&
-                strcmp(gameState->entities[i].type, "A") == 0) {
-                // Return the position of the A protein source
-                return current; // Return the position of the A protein source
-            }
+        if (grid->piece[current] == PIECE_PROTEIN) {
+            return (Point){grid_x(current), grid_y(current)};
         }
 
-        // Explore adjacent positions
+        // Explore adjacent positions; the wall border keeps every neighbor inside the grid.
+        // Organs block like walls: a GROW can only travel through empty or protein cells.
         for (int i = 0; i < 4; i++) {
-            int new_x = current.x + directions[i][0];
-            int new_y = current.y + directions[i][1];
-
-            // Check if the new position is within bounds and not a wall
-            if (is_within_bounds(new_x, new_y, gameState) && !visited[new_y][new_x]) {
-                // Check if the new position is a wall
-                bool is_wall = false;
-                for (int j = 0; j < gameState->entity_count; j++) {
-                    if (gameState->entities[j].x == new_x && gameState->entities[j].y == new_y &&
-                        strcmp(gameState->entities[j].type, "WALL") == 0) {
-                        is_wall = true;
-                        break;
-                    }
-                }
-
-                if (!is_wall) {
-                    visited[new_y][new_x] = true;
-                    parent[new_y][new_x] = current; // Set parent for path reconstruction
-                    queue[rear++] = (Point){new_x, new_y}; // Add to queue
-                }
+            int d = search_order[i];
+            int next = grid_nb[current][d];
+            if (!visit_seen(&visited, next) && piece_is_free(grid->piece[next])) {
+                visit_set(&visited, next);
+                path_tree_set(tree, next, DIR_OPPOSITE(d)); // Set parent for path reconstruction
+                queue[rear++] = next; // Add to queue
             }
         }
     }
@@ -147,116 +76,220 @@ Point find_a_protein(GameState *gameState, int start_x, int start_y, Point paren
     return (Point){-1, -1}; // Return an invalid point if no A protein source is found
 }
 
-// Function to decide the next action for growing an organ
-void decide_next_action(GameState *gameState) {
-    Point parent[gameState->height][gameState->width]; // Declare parent array here
-
-    if (gameState->my_proteins[0] > 0) { // Check if there are enough A proteins
-        // Iterate through all owned organs
-        for (int i = 0; i < gameState->entity_count; i++) {
-            if (gameState->entities[i].owner == 1) { // Find owned organ
-                int parent_id = gameState->entities[i].organ_id;
-                int start_x = gameState->entities[i].x;
-                int start_y = gameState->entities[i].y;
-
-                // Find the nearest A protein source starting from this organ
-                Point a_protein_location = find_a_protein(gameState, start_x, start_y, parent);
-
-                if (a_protein_location.x != -1 && a_protein_location.y != -1) {
-                    // Print the path taken to grow the new organ
-                    Point path_point = a_protein_location;
-                    while (parent[path_point.y][path_point.x].x != -1) {
-                        Point p = parent[path_point.y][path_point.x];
-                        // Print the direction taken
-                        for (int d = 0; d < 4; d++) {
-                            if (p.x == path_point.x + directions[d][0] && p.y == path_point.y + directions[d][1]) {
-                                fprintf(stderr, "Move %c to (%d , %d)\n", direction_chars[d], p.x, p.y);
-                                // print_grow_command(parent_id, p.x, p.y); // maybe should try here // :thinking:
-                                break;
-                            }
-                        }
-                        path_point = p; // Move to the parent
-                    }
-                    // print_grow_command(parent_id, p.x, p.y); // this is how i want it to be printed out
-                    print_grow_command(parent_id, a_protein_location.x, a_protein_location.y);
-                    return; // Exit after issuing the grow command
-                }
+// Function to decide the GROW of one organism, searching from each of its organs;
+// returns false if nothing was printed. Cells taken by an earlier organism this turn
+// are walled off in grid so two organisms never grow onto the same cell.
+bool decide_grow(GameState *gameState, Grid *grid, const OrganismIndex *organisms, int root_slot,
+                 const ThreatMap *threats) {
+    static PathTree tree;
+    int organ_count;
+    const int16_t *organs = organism_subtree(organisms, root_slot, &organ_count);
+
+    // Iterate through the organs of this organism
+    for (int i = 0; i < organ_count; i++) {
+        const Entity *organ = organism_entity(organisms, gameState, organs[i]);
+        int parent_id = organ->organ_id;
+        int start_x = organ->x;
+        int start_y = organ->y;
+
+        // Find the nearest A protein source starting from this organ
+        Point a_protein_location = find_a_protein(grid, start_x, start_y, &tree);
+
+        if (a_protein_location.x != -1 && a_protein_location.y != -1) {
+            // Print the path taken to grow the new organ
+            int path_point = grid_index(a_protein_location.x, a_protein_location.y);
+            for (int p; (p = path_tree_parent(&tree, path_point)) != -1; path_point = p) {
+                // Print the direction taken
+                fprintf(stderr, "Move %c to (%d , %d)\n", dir_chars[path_tree_dir(&tree, path_point)], grid_x(p), grid_y(p));
             }
+            print_grow_command(parent_id, a_protein_location.x, a_protein_location.y);
+            grid->piece[grid_index(a_protein_location.x, a_protein_location.y)] = PIECE_WALL;
+            return true; // Exit after issuing the grow command
         }
+    }
 
-        // If no A protein source is found, attempt to grow in an adjacent empty space
-        for (int i = 0; i < gameState->entity_count; i++) {
-            if (gameState->entities[i].owner == 1) { // Find owned organ
-                int parent_id = gameState->entities[i].organ_id;
-                int start_x = gameState->entities[i].x;
-                int start_y = gameState->entities[i].y;
-
-                // Check adjacent positions for empty spaces
-                for (int j = 0; j < 4; j++) {
-                    int new_x = start_x + (j == 0 ? -1 : (j == 1 ? 1 : 0));
-                    int new_y = start_y + (j == 2 ? -1 : (j == 3 ? 1 : 0));
-
-                    if (is_within_bounds(new_x, new_y, gameState) && 
-                        gameState->entities[new_y * gameState->width + new_x].owner == -1) { // Check if it's empty
-                        print_grow_command(parent_id, new_x, new_y);
-                        return; // Exit after issuing the grow command
-                    }
+    // If no A protein source is found, attempt to grow in an adjacent empty space, one
+    // that no enemy tentacle can reach next turn if there is any
+    for (int safe = 1; safe >= 0; safe--) {
+        for (int i = 0; i < organ_count; i++) {
+            const Entity *organ = organism_entity(organisms, gameState, organs[i]);
+            int idx = grid_index(organ->x, organ->y);
+
+            // Check adjacent positions for empty spaces: W, E, N, S
+            static const int fallback_order[4] = {3, 1, 0, 2};
+            for (int j = 0; j < 4; j++) {
+                int next = grid_nb[idx][fallback_order[j]];
+                if (piece_is_free(grid->piece[next]) && !(safe && threat_is_dangerous(threats, next))) {
+                    print_grow_command(organ->organ_id, grid_x(next), grid_y(next));
+                    grid->piece[next] = PIECE_WALL;
+                    return true; // Exit after issuing the grow command
                 }
             }
         }
-    } else {
-        fprintf(stderr, "Not enough proteins to grow.\n");
     }
+    return false;
 }
 
-/* ################################################################################# */
+// Function to list the grid cells of one organism's organs; returns their count
+static int organism_cells(const GameState *gameState, const OrganismIndex *organisms, int root_slot, int *cells) {
+    int organ_count;
+    const int16_t *organs = organism_subtree(organisms, root_slot, &organ_count);
+    for (int i = 0; i < organ_count; i++) {
+        const Entity *organ = organism_entity(organisms, gameState, organs[i]);
+        cells[i] = grid_index(organ->x, organ->y);
+    }
+    return organ_count;
+}
 
-int main() {
-    GameState gameState;
+// Function to take the next step of a spore toward an A source when it saves at least
+// spore_saving turns over growing there; returns false if nothing was printed
+bool decide_spore(GameState *gameState, Grid *grid, const RayTable *rays, const DistField *field,
+                  const OrganismIndex *organisms, int root_slot, int stock[4]) {
+    int cells[MAX_ENTITIES];
+    int organ_count = organism_cells(gameState, organisms, root_slot, cells);
+
+    SporePlan plan[4];
+    rays_plan(rays, grid, field, cells, organ_count, stock, plan);
+    if (plan[0].landing < 0 || plan[0].saving < path_params.v[PARAM_spore_saving]) {
+        return false;
+    }
+    fprintf(stderr, "Spore to (%d , %d) saves %d turns\n", grid_x(plan[0].landing), grid_y(plan[0].landing),
+            plan[0].saving);
+    rays_print_step(grid, &plan[0]);
+    int type = plan[0].parent >= 0 ? ORGAN_SPORER : ORGAN_ROOT;
+    for (int t = 0; t < 4; t++) {
+        stock[t] -= organ_cost[type][t];
+    }
+    grid->piece[plan[0].parent >= 0 ? plan[0].sporer : plan[0].landing] = PIECE_WALL;
+    return true;
+}
 
-    // Read width and height
-    scanf("%d%d", &gameState.width, &gameState.height);
+// Function to take the next step toward the organism's harvester plan, so sources are
+// harvested for income instead of eaten; the plan is refined until deadline. Returns
+// false if nothing was printed
+bool decide_harvest(GameState *gameState, Grid *grid, const DistField *field, const OrganismIndex *organisms,
+                    int root_slot, int stock[4], double deadline) {
+    int cells[MAX_ENTITIES];
+    int organ_count = organism_cells(gameState, organisms, root_slot, cells);
+    if (!harvest_can_start(grid, cells, organ_count, stock)) {
+        return false;
+    }
 
-    // Game loop
-    while (1) {
-        // Read entity count
-        scanf("%d", &gameState.entity_count);
-        for (int i = 0; i < gameState.entity_count; i++) {
-            // Read entity data
-            scanf("%d%d%s%d%d%s%d%d", 
-                  &gameState.entities[i].x, 
-                  &gameState.entities[i].y, 
-                  gameState.entities[i].type, 
-                  &gameState.entities[i].owner, 
-                  &gameState.entities[i].organ_id, 
-                  gameState.entities[i].organ_dir, 
-                  &gameState.entities[i].organ_parent_id, 
-                  &gameState.entities[i].organ_root_id);
+    HarvestPlan plan;
+    harvest_plan(grid, field, cells, organ_count, ME, stock, &path_params, deadline, &plan);
+    if (plan.step < 0) {
+        return false;
+    }
+    for (int t = 0; t < 4; t++) {
+        if (stock[t] < organ_cost[plan.type][t]) {
+            return false;
         }
+    }
+    fprintf(stderr, "Harvester plan: %d placements, value %d, %ld replays\n", plan.count, plan.value, plan.replays);
+    if (plan.type == ORGAN_HARVESTER) {
+        emit_action("GROW %d %d %d HARVESTER %c\n", grid->organ_id[plan.parent], grid_x(plan.step),
+                    grid_y(plan.step), dir_chars[plan.dir]);
+    } else {
+        print_grow_command(grid->organ_id[plan.parent], grid_x(plan.step), grid_y(plan.step));
+    }
+    for (int t = 0; t < 4; t++) {
+        stock[t] -= organ_cost[plan.type][t];
+    }
+    grid->piece[plan.step] = PIECE_WALL;
+    return true;
+}
 
-        // Read your protein stock
-        scanf("%d%d%d%d", 
-              &gameState.my_proteins[0], 
-              &gameState.my_proteins[1], 
-              &gameState.my_proteins[2], 
-              &gameState.my_proteins[3]);
+// Function to decide the next action of every organism: a spore when one reaches A much
+// sooner, then the harvester plan, else a GROW while A proteins last, WAIT for the others.
+// Cells an enemy tentacle attacks now are walled off for all of them. turn only tells
+// whether the threat map can follow on from the previous call.
+void decide_next_action(GameState *gameState, int turn) {
+    static Grid grid;
+    static OrganismIndex organisms;
+    static RayTable rays;
+    static DistField field;
+    static ThreatMap threats;
+    int stock[4];
+    int printed = 0, mine = 0;
+    double deadline = now_ms() + TURN_DEADLINE_MS;
+
+    PERF_BEGIN(TURN);
+    PERF_BEGIN(SETUP);
+    memcpy(stock, gameState->my_proteins, sizeof(stock));
+    grid_from_state(&grid, gameState);
+    if (turn != path_last_turn + 1) {
+        threat_init(&threats, &grid, OPP); // a new game, or positions out of order
+    } else {
+        threat_sync(&threats, &grid, gameState, gameState->opp_proteins);
+    }
+    path_last_turn = turn;
+    organism_index_build(&organisms, gameState);
+    rays_sync(&rays, &grid);
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        if (piece_is_free(grid.piece[idx]) && threat_now(&threats, idx) > 0) {
+            grid.piece[idx] = PIECE_WALL; // after rays_sync(), so its wall check stays quiet
+        }
+    }
+    dist_field_build(&field, &grid);
+    for (int r = 0; r < organisms.root_count && mine < gameState->required_actions_count; r++) {
+        mine += organism_entity(&organisms, gameState, organisms.roots[r])->owner == ME;
+    }
+    PERF_END(SETUP);
+    for (int r = 0; r < organisms.root_count && printed < gameState->required_actions_count; r++) {
+        const Entity *root = organism_entity(&organisms, gameState, organisms.roots[r]);
+        if (root->owner != ME) {
+            continue;
+        }
+        PERF_BEGIN(SPORE);
+        bool done = decide_spore(gameState, &grid, &rays, &field, &organisms, organisms.roots[r], stock);
+        PERF_END(SPORE);
+        if (!done) {
+            // Each organism still to decide gets an equal share of what is left of the turn
+            double start = now_ms();
+            PERF_BEGIN(HARVEST);
+            done = decide_harvest(gameState, &grid, &field, &organisms, organisms.roots[r], stock,
+                                  start + (deadline - start) / (mine - printed));
+            PERF_END(HARVEST);
+        }
+        if (!done && stock[0] > 0) {
+            PERF_BEGIN(GROW);
+            done = decide_grow(gameState, &grid, &organisms, organisms.roots[r], &threats);
+            PERF_END(GROW);
+            stock[0] -= done;
+        }
+        if (!done) {
+            if (stock[0] <= 0) {
+                fprintf(stderr, "Not enough proteins to grow.\n");
+            }
+            emit_action("WAIT\n");
+        }
+        printed++;
+    }
+    for (; printed < gameState->required_actions_count; printed++) {
+        emit_action("WAIT\n");
+    }
+    PERF_END(TURN);
+}
 
-        // Read opponent's protein stock
-        scanf("%d%d%d%d", 
-              &gameState.opp_proteins[0], 
-              &gameState.opp_proteins[1], 
-              &gameState.opp_proteins[2], 
-              &gameState.opp_proteins[3]);
+/* ################################################################################# */
 
-        // Read required actions count
-        scanf("%d", &gameState.required_actions_count);
+// Strategy adapters: the parameters are read once per game
+static bool path_to_a_begin(void) {
+    Params p;
+    params_from_env(&p);
+    params_print(&p, stderr);
+    path_to_a_use(&p);
+    path_last_turn = -1;
+    return true;
+}
 
-        // Print the current state of the game map
-        print_map(&gameState);
+static void path_to_a_decide(GameState *gameState, int turn) {
+    decide_next_action(gameState, turn);
+}
 
-        // Decide the next action for growing an organ
-        decide_next_action(&gameState);
-    }
+const Strategy strategy_path_to_a = {"pathToA", "BFS toward A, spores for far sources, harvester plans", false,
+                                     path_to_a_begin, path_to_a_decide, NULL};
 
-    return 0;
-}
\ No newline at end of file
+#ifndef BOSS1_NO_MAIN // tools that reuse this bot's functions include it with BOSS1_NO_MAIN
+int main() { return strategy_run(&strategy_path_to_a); }
+#endif
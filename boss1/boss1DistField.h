@@ -0,0 +1,96 @@
+#ifndef BOSS1_DISTFIELD_H
+#define BOSS1_DISTFIELD_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+
+// Nearest-source distance fields for all four protein types. One multi-source BFS,
+// seeded from every protein cell, carries a 4-bit "types arriving" mask per cell, so
+// the four fields are built in a single pass over the grid instead of one BFS per
+// type (or per organ). Run it once per turn; every lookup afterwards is O(1).
+
+#define DIST_UNREACHED 255
+
+typedef struct {
+    uint8_t dist[4][GRID_CELLS];      // steps from a free cell to the nearest A..D source
+    uint8_t step[4][GRID_CELLS];      // direction of the first step toward that source
+} DistField;
+
+// Function to build the four fields; only free cells (empty or protein) are crossed
+void dist_field_build(DistField *f, const Grid *g) {
+    static int16_t frontier[2][GRID_CELLS];
+    static uint8_t bits[2][GRID_CELLS];   // types that reached a cell on the current / next level
+    static uint8_t reached[GRID_CELLS];   // types whose distance is already final at a cell
+    int count = 0, cur = 0;
+
+    memset(f->dist, DIST_UNREACHED, sizeof(f->dist));
+    memset(f->step, 0, sizeof(f->step));
+    memset(bits, 0, sizeof(bits));
+
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        reached[idx] = piece_is_free(g->piece[idx]) ? 0 : 0x0F; // walls and organs are never entered
+        if (piece_is_protein(g->piece[idx])) {
+            int t = g->piece[idx] - PIECE_PROTEIN;
+            f->dist[t][idx] = 0;
+            bits[cur][idx] = (uint8_t)(1 << t);
+            reached[idx] = (uint8_t)(1 << t);
+            frontier[cur][count++] = (int16_t)idx;
+        }
+    }
+
+    for (int level = 1; count > 0 && level < DIST_UNREACHED; level++) {
+        int next_count = 0;
+        for (int i = 0; i < count; i++) {
+            int c = frontier[cur][i];
+            int mask = bits[cur][c];
+            bits[cur][c] = 0;
+            for (int d = 0; d < 4; d++) {
+                int nb = grid_nb[c][d];
+                // Types that arrive at nb for the first time, on this level
+                int fresh = mask & ~reached[nb];
+                if (fresh == 0) {
+                    continue;
+                }
+                reached[nb] |= (uint8_t)fresh;
+                for (int m = fresh; m; m &= m - 1) {
+                    int t = __builtin_ctz(m);
+                    f->dist[t][nb] = (uint8_t)level;
+                    f->step[t][nb] = (uint8_t)DIR_OPPOSITE(d);
+                }
+                if (bits[cur ^ 1][nb] == 0) {
+                    frontier[cur ^ 1][next_count++] = (int16_t)nb;
+                }
+                bits[cur ^ 1][nb] |= (uint8_t)fresh;
+            }
+        }
+        cur ^= 1;
+        count = next_count;
+    }
+}
+
+// Distance from a free cell to the nearest source of a type, DIST_UNREACHED if none
+static inline int dist_field_get(const DistField *f, int idx, int type) { return f->dist[type][idx]; }
+
+// Next cell on a shortest path from a free cell toward the nearest source of a type
+static inline int dist_field_next(const DistField *f, int idx, int type) { return grid_nb[idx][f->step[type][idx]]; }
+
+// Function to look up the nearest source of a type from an organ, which is not itself
+// on the field: the best free neighbor plus one. dir receives the direction to grow in.
+int dist_field_from_organ(const DistField *f, int idx, int type, int *dir) {
+    int best = DIST_UNREACHED;
+    for (int d = 0; d < 4; d++) {
+        int dist = f->dist[type][grid_nb[idx][d]];
+        if (dist + 1 < best) {
+            best = dist + 1;
+            *dir = d;
+        }
+    }
+    return best;
+}
+
+#endif
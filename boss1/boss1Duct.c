@@ -0,0 +1,86 @@
+#include "boss1Core.h"
+#include "boss1Sim.h"
+#include "boss1Duct.h"
+#include "boss1Log.h"
+#include "boss1Book.h"
+#include "boss1Endgame.h"
+#include "boss1Perf.h"
+#include "boss1Strategy.h"
+
+// Bot that plays the decoupled-UCT search against the opponent, and keeps searching
+// below its move while the opponent thinks (duct_ponder()).
+//
+//   gcc -O2 -o boss1Duct boss1Duct.c -lm
+
+#define FIRST_TURN_BUDGET_MS 900.0
+#define TURN_BUDGET_MS 40.0
+#define ENDGAME_BUDGET_MS 20.0     // the search gets the rest if the solver gives up
+
+static Duct duct_bot;
+static const BookEntry *duct_bot_book;
+static uint32_t duct_bot_played;      // this turn's move if the search chose it, else MOVE_NONE
+
+#define MOVE_NONE UINT32_MAX
+
+// Function to set up a game: the node pool once per process, the book line per game
+static bool duct_bot_begin(void) {
+    zobrist_init(1);
+    duct_bot_book = NULL;
+    duct_bot_played = MOVE_NONE;
+    if (duct_bot.pool != NULL) {
+        duct_forget(&duct_bot);
+        return true;
+    }
+    return duct_init(&duct_bot, 12345);
+}
+
+static void duct_bot_decide(GameState *gameState, int turn) {
+    static SimState state;
+    double started = now_ms();
+
+    sim_load(&state, gameState);
+    state.turn = turn;
+
+    // Play from the opening book while the game follows its line; once every
+    // contested region is small, solve it exactly; search otherwise
+    if (turn == 0) {
+        duct_bot_book = book_find(&state);
+    }
+    uint32_t move = book_move(duct_bot_book, &state);
+    double deadline = started + (turn == 0 ? FIRST_TURN_BUDGET_MS : TURN_BUDGET_MS);
+    duct_bot_played = MOVE_NONE;
+    if (move != BOOK_MISS) {
+        fprintf(stderr, "book move, turn %d\n", turn);
+    } else {
+        duct_bot_book = NULL;
+        if (!endgame_move(&state, ME, started + ENDGAME_BUDGET_MS, &move)) {
+            PERF_BEGIN(SEARCH);
+            move = duct_search(&duct_bot, &state, deadline - now_ms());
+            PERF_END(SEARCH);
+            duct_report(&duct_bot, stderr);
+            duct_bot_played = move;
+        }
+    }
+
+    // One action for the searched organism, WAIT for the others
+    sim_print_move(&state, move);
+    strategy_wait_rest(gameState, 1);
+}
+
+// Function to search on below our move until the next turn arrives; a turn played from
+// the book or the solver leaves no tree to continue
+static void duct_bot_ponder(void) {
+    if (duct_bot_played == MOVE_NONE) {
+        duct_forget(&duct_bot);
+        return;
+    }
+    duct_ponder(&duct_bot, duct_bot_played, strategy_input_ready);
+}
+
+const Strategy strategy_duct = {"duct", "decoupled UCT with opening book and endgame solver", true, duct_bot_begin,
+                                duct_bot_decide, duct_bot_ponder};
+
+/* ############# Program Starts Here ############################################### */
+#ifndef BOSS1_NO_MAIN
+int main() { return strategy_run(&strategy_duct); }
+#endif
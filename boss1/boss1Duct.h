@@ -0,0 +1,383 @@
+#ifndef BOSS1_DUCT_H
+#define BOSS1_DUCT_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+
+#include "boss1Core.h"
+#include "boss1Sim.h"
+#include "boss1Zobrist.h"
+
+// Decoupled UCT for the simultaneous GROW game. Every node keeps separate action
+// statistics for each player; at selection time each player picks its own action by
+// UCB1 on its own statistics, and the joint pair selects (or creates) the child.
+// Nodes come from a pool allocated once, rollouts play random moves through the
+// forward simulator, and the search runs until the turn deadline.
+//
+// Joint moves played in a different order often reach the same position. The tree
+// stays a tree, but every node is filed in a transposition table under its Zobrist
+// hash, and a new node whose position is already in the tree starts from that node's
+// candidate actions and statistics instead of from nothing.
+//
+// Between turns duct_ponder() keeps searching below the move we played, over every
+// opponent reply. The next duct_search() looks for the child whose position hashes
+// like the real one and carries that subtree over as its root; when the pool is
+// past half full the subtree is first compacted to the front of it.
+
+#ifndef DUCT_MAX_ACTIONS
+#define DUCT_MAX_ACTIONS 24           // actions kept per player per node, WAIT included
+#endif
+#ifndef DUCT_POOL_NODES
+#define DUCT_POOL_NODES 60000         // ~600 bytes per node, ~36 MB in total
+#endif
+#define DUCT_TT_MB 4                  // 256K entries for at most DUCT_POOL_NODES live nodes
+#define DUCT_ROLLOUT_TURNS 8
+#define DUCT_EXPLORATION 0.7f
+#define DUCT_LAST_TURN 100
+
+typedef struct {
+    uint64_t hash;                              // Zobrist hash of the node's position
+    uint32_t actions[2][DUCT_MAX_ACTIONS];      // per owner (OPP = 0, ME = 1)
+    uint32_t action_visits[2][DUCT_MAX_ACTIONS];
+    float action_reward[2][DUCT_MAX_ACTIONS];   // summed from that owner's point of view
+    uint32_t visits;
+    int32_t first_child;
+    int32_t next_sibling;
+    uint16_t joint;                             // my action index * DUCT_MAX_ACTIONS + opp action index
+    uint8_t action_count[2];
+} DuctNode;
+
+typedef struct {
+    DuctNode *pool;
+    int32_t *remap;                   // scratch for compaction, one entry per pool node
+    int32_t used;
+    int32_t root;
+    int root_action;                  // our action forced at the root while pondering, -1 otherwise
+    SimState root_state;
+    uint64_t rng;
+    TransTable table;                 // position hash -> the latest node holding it
+    // instrumentation
+    long iterations;
+    long transpositions;              // nodes seeded from another node of the same position
+    long ponder_iterations;
+    int32_t reused;                   // root visits carried over by the last search
+    double elapsed_ms;
+} Duct;
+
+/* #############  HELPERS #################################################### */
+
+static inline uint32_t duct_rand(Duct *d) {
+    d->rng ^= d->rng << 13;
+    d->rng ^= d->rng >> 7;
+    d->rng ^= d->rng << 17;
+    return (uint32_t)(d->rng >> 11);
+}
+
+// Function to allocate the node pool once per game
+bool duct_init(Duct *d, uint64_t seed) {
+    memset(d, 0, sizeof(*d));
+    d->pool = malloc(sizeof(DuctNode) * DUCT_POOL_NODES);
+    d->remap = malloc(sizeof(int32_t) * DUCT_POOL_NODES);
+    d->root = -1;
+    d->root_action = -1;
+    d->rng = seed ? seed : 0x9E3779B97F4A7C15ULL;
+    return d->pool != NULL && d->remap != NULL && tt_init(&d->table, (size_t)DUCT_TT_MB << 20);
+}
+
+// Function to forget the tree, so the next search starts from scratch
+static inline void duct_forget(Duct *d) {
+    d->root = -1;
+    d->root_action = -1;
+}
+
+// Function to pick the candidate actions of one owner: protein-absorbing and harvester
+// grows first, then the rest in a random order, capped at DUCT_MAX_ACTIONS with WAIT
+static int duct_candidates(Duct *d, const SimState *s, int owner, uint32_t *out) {
+    uint32_t moves[SIM_MAX_MOVES];
+    int n = sim_gen_grows(s, owner, moves, SIM_MAX_MOVES);
+    int count = 0;
+
+    for (int i = n - 1; i > 0; i--) { // shuffle so the cap does not always drop the same cells
+        int j = duct_rand(d) % (i + 1);
+        uint32_t t = moves[i];
+        moves[i] = moves[j];
+        moves[j] = t;
+    }
+    for (int pass = 0; pass < 2; pass++) {
+        for (int i = 0; i < n && count < DUCT_MAX_ACTIONS - 1; i++) {
+            bool preferred = move_type(moves[i]) == ORGAN_HARVESTER || piece_is_protein(s->grid.piece[move_to(moves[i])]);
+            if (preferred == (pass == 0)) {
+                out[count++] = moves[i];
+            }
+        }
+    }
+    out[count++] = MOVE_WAIT;
+    return count;
+}
+
+// Function to add a node for position s. If the table names a live node of the same
+// position, its actions and statistics are copied; the entry's move holds the node id,
+// which the hash check rejects once the pool was reset or compacted under it.
+static int32_t duct_new_node(Duct *d, const SimState *s) {
+    if (d->used >= DUCT_POOL_NODES) {
+        return -1;
+    }
+    int32_t id = d->used++;
+    DuctNode *node = &d->pool[id];
+    const TTEntry *e = tt_probe(&d->table, s->hash);
+    int32_t same = e != NULL ? (int32_t)e->move : -1;
+    if (same >= 0 && same < id && d->pool[same].hash == s->hash) {
+        *node = d->pool[same];
+        d->transpositions++;
+    } else {
+        node->hash = s->hash;
+        memset(node->action_visits, 0, sizeof(node->action_visits));
+        memset(node->action_reward, 0, sizeof(node->action_reward));
+        node->visits = 0;
+        for (int owner = 0; owner < 2; owner++) {
+            node->action_count[owner] = (uint8_t)duct_candidates(d, s, owner, node->actions[owner]);
+        }
+    }
+    node->first_child = -1;
+    node->next_sibling = -1;
+    tt_store(&d->table, s->hash, 0, 0, TT_EXACT, (uint32_t)id);
+    return id;
+}
+
+// Function to pick one owner's action by UCB1 over that owner's statistics only
+static int duct_select(const DuctNode *node, int owner) {
+    int best = 0;
+    float best_score = -1.0f;
+    float log_n = logf((float)node->visits + 1.0f);
+    for (int a = 0; a < node->action_count[owner]; a++) {
+        uint32_t n = node->action_visits[owner][a];
+        if (n == 0) {
+            return a; // untried actions first, in candidate order
+        }
+        float score = node->action_reward[owner][a] / n + DUCT_EXPLORATION * sqrtf(log_n / n);
+        if (score > best_score) {
+            best_score = score;
+            best = a;
+        }
+    }
+    return best;
+}
+
+// Reward for ME in [0, 1]: the organ difference squashed around a draw
+static float duct_evaluate(const SimState *s) {
+    float diff = (float)(s->organ_count[ME] - s->organ_count[OPP]);
+    return 0.5f + 0.5f * diff / (fabsf(diff) + 4.0f);
+}
+
+// Function to play random moves for both owners through the simulator
+static float duct_rollout(Duct *d, SimState *s) {
+    uint32_t moves[2][SIM_MAX_MOVES];
+    for (int t = 0; t < DUCT_ROLLOUT_TURNS && s->turn < DUCT_LAST_TURN; t++) {
+        uint32_t pick[2];
+        for (int owner = 0; owner < 2; owner++) {
+            int n = sim_gen_grows(s, owner, moves[owner], SIM_MAX_MOVES);
+            pick[owner] = n ? moves[owner][duct_rand(d) % n] : MOVE_WAIT;
+        }
+        sim_apply_joint(s, pick[ME], pick[OPP]);
+        sim_end_turn(s);
+    }
+    return duct_evaluate(s);
+}
+
+/* ################################################################################# */
+
+/* #############  SEARCH ##################################################### */
+
+// Function to run one selection / expansion / rollout / backpropagation pass. The path
+// lives on the stack so that threads with their own Duct can search side by side.
+static void duct_iterate(Duct *d, int32_t root, const SimState *root_state) {
+    int32_t path[256];
+    uint8_t picked[256][2];
+    SimState s = *root_state;
+    int depth = 0;
+    int32_t id = root;
+
+    while (depth < 255) {
+        DuctNode *node = &d->pool[id];
+        int a_me = depth == 0 && d->root_action >= 0 ? d->root_action : duct_select(node, ME);
+        int a_opp = duct_select(node, OPP);
+        path[depth] = id;
+        picked[depth][ME] = (uint8_t)a_me;
+        picked[depth][OPP] = (uint8_t)a_opp;
+        depth++;
+
+        sim_apply_joint(&s, node->actions[ME][a_me], node->actions[OPP][a_opp]);
+        sim_end_turn(&s);
+        if (s.turn >= DUCT_LAST_TURN) {
+            break;
+        }
+
+        uint16_t joint = (uint16_t)(a_me * DUCT_MAX_ACTIONS + a_opp);
+        int32_t child = node->first_child;
+        while (child >= 0 && d->pool[child].joint != joint) {
+            child = d->pool[child].next_sibling;
+        }
+        if (child < 0) {
+            child = duct_new_node(d, &s); // pool exhausted: keep searching without growing the tree
+            if (child >= 0) {
+                d->pool[child].joint = joint;
+                d->pool[child].next_sibling = node->first_child;
+                node->first_child = child;
+            }
+            break;
+        }
+        id = child;
+    }
+
+    float reward = duct_rollout(d, &s);
+    for (int i = 0; i < depth; i++) {
+        DuctNode *node = &d->pool[path[i]];
+        node->visits++;
+        node->action_visits[ME][picked[i][ME]]++;
+        node->action_reward[ME][picked[i][ME]] += reward;
+        node->action_visits[OPP][picked[i][OPP]]++;
+        node->action_reward[OPP][picked[i][OPP]] += 1.0f - reward;
+    }
+}
+
+// Function to read the most visited root action of owner after a search; for OPP this
+// is the reply the search expects
+uint32_t duct_best(const Duct *d, int owner) {
+    const DuctNode *node = &d->pool[d->root];
+    int best = node->action_count[owner] - 1; // WAIT
+    for (int a = 0; a < node->action_count[owner]; a++) {
+        if (node->action_visits[owner][a] > node->action_visits[owner][best]) {
+            best = a;
+        }
+    }
+    return node->actions[owner][best];
+}
+
+/* ################################################################################# */
+
+/* #############  TREE REUSE ################################################# */
+
+// Function to move the subtree of node keep to the front of the pool. Children are
+// always allocated after their parent, so renumbering the kept nodes in pool order
+// makes keep node 0 and never moves a node onto one not yet copied.
+static void duct_compact(Duct *d, int32_t keep) {
+    static int32_t stack[DUCT_POOL_NODES];
+    int top = 0;
+    for (int32_t i = keep; i < d->used; i++) {
+        d->remap[i] = -1;
+    }
+    d->remap[keep] = 0;
+    stack[top++] = keep;
+    while (top > 0) {
+        for (int32_t c = d->pool[stack[--top]].first_child; c >= 0; c = d->pool[c].next_sibling) {
+            d->remap[c] = 0;
+            stack[top++] = c;
+        }
+    }
+    int32_t used = 0;
+    for (int32_t i = keep; i < d->used; i++) {
+        if (d->remap[i] >= 0) {
+            d->remap[i] = used++;
+        }
+    }
+    for (int32_t i = keep; i < d->used; i++) {
+        if (d->remap[i] >= 0) {
+            DuctNode *node = &d->pool[d->remap[i]];
+            *node = d->pool[i];
+            node->first_child = node->first_child >= 0 ? d->remap[node->first_child] : -1;
+            node->next_sibling = i != keep && node->next_sibling >= 0 ? d->remap[node->next_sibling] : -1;
+        }
+    }
+    d->used = used;
+}
+
+// Function to find the child of the pondered root that reached state: our pondered
+// action with each opponent reply, compared by Zobrist hash. Returns true and makes it
+// the root if one matches.
+static bool duct_reuse(Duct *d, const SimState *state) {
+    if (d->root < 0 || d->root_action < 0) {
+        return false;
+    }
+    const DuctNode *root = &d->pool[d->root];
+    for (int32_t c = root->first_child; c >= 0; c = d->pool[c].next_sibling) {
+        int a_me = d->pool[c].joint / DUCT_MAX_ACTIONS, a_opp = d->pool[c].joint % DUCT_MAX_ACTIONS;
+        if (a_me != d->root_action) {
+            continue;
+        }
+        SimState s = d->root_state;
+        sim_apply_joint(&s, root->actions[ME][a_me], root->actions[OPP][a_opp]);
+        sim_end_turn(&s);
+        if (s.hash == state->hash) {
+            if (d->used > DUCT_POOL_NODES / 2) {
+                duct_compact(d, c);
+                c = 0;
+            }
+            d->root = c;
+            return true;
+        }
+    }
+    return false;
+}
+
+/* ################################################################################# */
+
+/* #############  ENTRY POINTS ############################################### */
+
+// Function to search from the given state until budget_ms has passed and return our
+// most visited root action; the pondered subtree is reused if the game followed it
+uint32_t duct_search(Duct *d, const SimState *state, double budget_ms) {
+    double start = now_ms();
+    double deadline = start + budget_ms;
+
+    tt_new_generation(&d->table);
+    if (!duct_reuse(d, state)) {
+        d->used = 0;
+        d->root = duct_new_node(d, state);
+    }
+    d->root_action = -1;
+    d->root_state = *state;
+    d->reused = (int32_t)d->pool[d->root].visits;
+    d->iterations = 0;
+    d->transpositions = 0;
+    do {
+        for (int i = 0; i < 16; i++) { // amortise the clock read
+            duct_iterate(d, d->root, state);
+        }
+        d->iterations += 16;
+    } while (now_ms() < deadline);
+    d->elapsed_ms = now_ms() - start;
+    return duct_best(d, ME);
+}
+
+// Function to keep searching below our played move, one iteration at a time, until
+// stop() returns true; played must be a root action of the last search
+void duct_ponder(Duct *d, uint32_t played, bool (*stop)(void)) {
+    const DuctNode *root = &d->pool[d->root];
+    d->ponder_iterations = 0;
+    for (int a = 0; a < root->action_count[ME]; a++) {
+        if (root->actions[ME][a] == played) {
+            d->root_action = a;
+        }
+    }
+    while (d->root_action >= 0 && !stop()) {
+        duct_iterate(d, d->root, &d->root_state);
+        d->ponder_iterations++;
+    }
+}
+
+// Function to print the search counters to stderr
+void duct_report(const Duct *d, FILE *out) {
+    fprintf(out,
+            "DUCT: %ld iterations in %.1f ms (%.0f it/s), %d/%d nodes, %ld transpositions, %d visits reused, %ld "
+            "pondered\n",
+            d->iterations, d->elapsed_ms, d->elapsed_ms > 0 ? d->iterations * 1000.0 / d->elapsed_ms : 0.0, d->used,
+            DUCT_POOL_NODES, d->transpositions, d->reused, d->ponder_iterations);
+}
+
+/* ################################################################################# */
+
+#endif
@@ -0,0 +1,381 @@
+#ifndef BOSS1_ENDGAME_H
+#define BOSS1_ENDGAME_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+#include "boss1Zobrist.h"
+#include "boss1Sim.h"
+
+// Exact solver for small sealed regions: connected areas of free cells of up to
+// ENDGAME_MAX_CELLS cells, closed off by walls and organs. Inside a region the game
+// is a fill race: each turn a player claims one free cell next to cells it already
+// has. The region is renumbered into bit positions, and alpha-beta over (free cells,
+// my reach, their reach) masks with the transposition table of boss1Zobrist.h finds
+// the fill order that claims the most cells for us.
+//
+// Model: we move first each turn (the simultaneous turn is played as our move, then
+// theirs). Once no cell can be reached by both sides, the rest of the region is
+// counted at once. A free cell only reachable by one side can be claimed at any time,
+// so all such cells are one "tempo" move; while a cell is contested the side to move
+// can always reach one, so nobody is ever left without a move.
+//
+// The root runs MTD(f) from a flood-race estimate. Moves come from the contested cells
+// next to the side's organs only, the table's move first, then by race estimate, then
+// by how often a move cut off a search before (history).
+//
+// The cost grows with the cells both sides can still reach, not with the region: an
+// open 5x4 block solves in a few ms, 5x5 in about 20, 6x5 in 30-250 and an open
+// 40-cell block takes many seconds. So a region is only handed to the solver once at
+// most ENDGAME_MAX_CONTESTED of its cells are contested; the bench's endgame rows time
+// an open block of that size against the solver's share of the turn.
+
+#ifndef ENDGAME_MAX_CELLS
+#define ENDGAME_MAX_CELLS 40          // regions up to 64 cells fit the masks
+#endif
+#ifndef ENDGAME_MAX_CONTESTED
+#define ENDGAME_MAX_CONTESTED 20      // an open block this size solves in half the duct bot's ENDGAME_BUDGET_MS
+#endif
+#define ENDGAME_TT_MB 16              // 1M entries in the shared TransTable layout
+
+typedef struct {
+    int count;
+    int16_t cell[64];                 // bit -> grid index
+    uint64_t adj[64];                 // bit -> neighbor bits inside the region
+    uint64_t reach[2];                // per owner: cells next to that owner's organs
+    int contested;                    // cells both owners can reach
+} EndgameRegion;
+
+// Entries of the shared table keep the best bit + 1 as the move (0 for none) and the
+// free cells left as the depth, so replacement favors the larger subtrees
+typedef struct {
+    TransTable *table;
+    uint64_t salt;                    // per solve, so old entries never match and the table is not cleared
+    double deadline;
+    long nodes;
+    bool aborted;
+    int history[64];                  // per bit: free cells left below the cutoffs it caused
+} EndgameSolver;
+
+// Function to flood from seed through free cells
+static inline uint64_t endgame_flood(const EndgameRegion *r, uint64_t free, uint64_t seed) {
+    uint64_t filled = seed & free, frontier = filled;
+    while (frontier) {
+        uint64_t next = 0;
+        for (uint64_t m = frontier; m; m &= m - 1) {
+            next |= r->adj[__builtin_ctzll(m)];
+        }
+        frontier = next & free & ~filled;
+        filled |= frontier;
+    }
+    return filled;
+}
+
+/* #############  REGIONS #################################################### */
+
+// Function to list the sealed regions small enough to solve; a region counts only if
+// both owners touch it, since an uncontested region is filled in any order. *all_small
+// (if not NULL) tells whether every region both owners touch was listed: it is false
+// if one is too large, has too many contested cells, or does not fit in max_regions.
+int endgame_regions(const Grid *grid, EndgameRegion *out, int max_regions, bool *all_small) {
+    static VisitMarks seen;
+    static int queue[GRID_CELLS];
+    static int8_t bit_of[GRID_CELLS];
+    int found = 0;
+
+    if (all_small) {
+        *all_small = true;
+    }
+    visit_begin(&seen);
+    for (int start = 0; start < GRID_CELLS; start++) {
+        if (!piece_is_free(grid->piece[start]) || visit_seen(&seen, start)) {
+            continue;
+        }
+        int front = 0, rear = 0;
+        queue[rear++] = start;
+        visit_set(&seen, start);
+        while (front < rear) {
+            int c = queue[front++];
+            for (int d = 0; d < 4; d++) {
+                int nb = grid_nb[c][d];
+                if (piece_is_free(grid->piece[nb]) && !visit_seen(&seen, nb)) {
+                    visit_set(&seen, nb);
+                    queue[rear++] = nb;
+                }
+            }
+        }
+        if (rear > ENDGAME_MAX_CELLS) {
+            if (all_small && !*all_small) {
+                continue;
+            }
+            bool touched[2] = {false, false};
+            for (int i = 0; i < rear; i++) {
+                for (int d = 0; d < 4; d++) {
+                    int piece = grid->piece[grid_nb[queue[i]][d]];
+                    if (piece_is_organ(piece)) {
+                        touched[piece_owner(piece)] = true;
+                    }
+                }
+            }
+            if (all_small && touched[ME] && touched[OPP]) {
+                *all_small = false;
+            }
+            continue;
+        }
+
+        // Past max_regions the region is still built, in a scratch slot, to tell whether
+        // it is contested
+        static EndgameRegion overflow;
+        EndgameRegion *r = found < max_regions ? &out[found] : &overflow;
+        memset(r, 0, sizeof(*r));
+        r->count = rear;
+        for (int i = 0; i < rear; i++) {
+            r->cell[i] = (int16_t)queue[i];
+            bit_of[queue[i]] = (int8_t)i;
+        }
+        for (int i = 0; i < rear; i++) {
+            for (int d = 0; d < 4; d++) {
+                int nb = grid_nb[queue[i]][d];
+                int piece = grid->piece[nb];
+                if (piece_is_free(piece)) {
+                    r->adj[i] |= 1ULL << bit_of[nb];
+                } else if (piece_is_organ(piece)) {
+                    r->reach[piece_owner(piece)] |= 1ULL << i;
+                }
+            }
+        }
+        if (!r->reach[ME] || !r->reach[OPP]) {
+            continue;
+        }
+        uint64_t all = rear == 64 ? ~0ULL : (1ULL << rear) - 1;
+        r->contested = __builtin_popcountll(endgame_flood(r, all, r->reach[ME]) & endgame_flood(r, all, r->reach[OPP]));
+        if (found < max_regions && r->contested <= ENDGAME_MAX_CONTESTED) {
+            found++;
+        } else if (all_small) {
+            *all_small = false;
+        }
+    }
+    return found;
+}
+
+/* ################################################################################# */
+
+/* #############  SEARCH ##################################################### */
+
+// Function to estimate a position by a race: both sides flood a step per turn, the
+// side to move first, and a cell goes to whoever floods it first
+static int endgame_voronoi(const EndgameRegion *r, uint64_t free, uint64_t side_reach, uint64_t other_reach) {
+    uint64_t side = side_reach & free, other = other_reach & free & ~side;
+    uint64_t side_front = side, other_front = other, claimed = side | other;
+    while (side_front | other_front) {
+        uint64_t next = 0;
+        for (uint64_t m = side_front; m; m &= m - 1) {
+            next |= r->adj[__builtin_ctzll(m)];
+        }
+        side_front = next & free & ~claimed;
+        claimed |= side_front;
+        next = 0;
+        for (uint64_t m = other_front; m; m &= m - 1) {
+            next |= r->adj[__builtin_ctzll(m)];
+        }
+        other_front = next & free & ~claimed;
+        claimed |= other_front;
+        side |= side_front;
+        other |= other_front;
+    }
+    return __builtin_popcountll(side) - __builtin_popcountll(other);
+}
+
+static inline uint64_t endgame_key(uint64_t salt, uint64_t free, uint64_t side_reach, uint64_t other_reach) {
+    uint64_t h = (free ^ salt) * 0x9E3779B97F4A7C15ULL;
+    h ^= (side_reach & free) * 0xC2B2AE3D27D4EB4FULL + (h >> 29);
+    h ^= (other_reach & free) * 0x165667B19E3779F9ULL + (h >> 31);
+    return h | 1; // 0 marks an empty slot
+}
+
+// Negamax: cells the side to move claims from here on minus the other side's. best
+// receives the bit to claim, -1 once nothing is contested.
+static int endgame_search(EndgameSolver *es, const EndgameRegion *r, uint64_t free, uint64_t side_reach,
+                          uint64_t other_reach, int alpha, int beta, int *best) {
+    *best = -1;
+    if ((++es->nodes & 1023) == 0 && now_ms() > es->deadline) {
+        es->aborted = true;
+    }
+    if (es->aborted) {
+        return 0;
+    }
+
+    uint64_t mine = endgame_flood(r, free, side_reach), theirs = endgame_flood(r, free, other_reach);
+    uint64_t contested = mine & theirs;
+    if (contested == 0) {
+        return __builtin_popcountll(mine) - __builtin_popcountll(theirs);
+    }
+
+    // Bounds: the side to move gets at most what it can flood and at least the cells
+    // only it can flood
+    int upper = __builtin_popcountll(mine) - __builtin_popcountll(theirs & ~contested);
+    int lower = __builtin_popcountll(mine & ~contested) - __builtin_popcountll(theirs);
+    if (upper <= alpha) {
+        return upper;
+    }
+    if (lower >= beta) {
+        return lower;
+    }
+
+    // Every entry is searched to the end of the region, so its depth never limits a hit
+    uint64_t key = endgame_key(es->salt, free, side_reach, other_reach);
+    const TTEntry *e = tt_probe(es->table, key);
+    int tt_move = -2;
+    if (e != NULL) {
+        int flag = e->gen_flag & 3;
+        if (flag == TT_EXACT || (flag == TT_LOWER && e->value >= beta) || (flag == TT_UPPER && e->value <= alpha)) {
+            *best = (int)e->move - 1;
+            return e->value;
+        }
+        tt_move = (int)e->move - 1;
+    }
+
+    // Contested cells we can claim now; one tempo move if we also have a cell of our own.
+    // contested lies inside mine, the flood of side_reach & free, so there is always one
+    uint64_t moves = side_reach & free & contested;
+    uint64_t own = side_reach & free & ~contested;
+    int order[65], key_of[65], count = 0;
+    for (uint64_t m = moves; m; m &= m - 1) { // the table's move, then race estimate, then history
+        int b = __builtin_ctzll(m);
+        int k = b == tt_move ? INT32_MIN
+                             : endgame_voronoi(r, free & ~(1ULL << b), other_reach, side_reach | r->adj[b]) * 4096 -
+                                   (es->history[b] < 4095 ? es->history[b] : 4095);
+        int i = count++;
+        for (; i > 0 && key_of[i - 1] > k; i--) {
+            order[i] = order[i - 1];
+            key_of[i] = key_of[i - 1];
+        }
+        order[i] = b;
+        key_of[i] = k;
+    }
+    if (own) {
+        order[count++] = __builtin_ctzll(own);
+    }
+
+    int alpha0 = alpha, value = -64;
+    for (int i = 0; i < count && !es->aborted; i++) {
+        int b = order[i], reply;
+        uint64_t bit = 1ULL << b;
+        int v = 1 - endgame_search(es, r, free & ~bit, other_reach, side_reach | r->adj[b], -beta + 1, -alpha + 1,
+                                   &reply);
+        if (v > value) {
+            value = v;
+            *best = b;
+        }
+        alpha = v > alpha ? v : alpha;
+        if (alpha >= beta) {
+            es->history[b] += __builtin_popcountll(free);
+            break;
+        }
+    }
+
+    if (!es->aborted) {
+        tt_store(es->table, key, value, __builtin_popcountll(free),
+                 value <= alpha0 ? TT_UPPER : value >= beta ? TT_LOWER : TT_EXACT, (uint32_t)(*best + 1));
+    }
+    return value;
+}
+
+// Function to solve a region for owner (who moves first) by the deadline. Returns
+// false if the search ran out of time; otherwise *value is owner's cells minus the
+// opponent's over the region and *cell the grid index to claim, -1 to play elsewhere.
+bool endgame_solve(TransTable *table, const EndgameRegion *r, int owner, double deadline, int *cell, int *value,
+                   long *nodes) {
+    static uint64_t solves;
+    static EndgameSolver es;
+    memset(&es, 0, sizeof(es));
+    es.table = table;
+    es.salt = zobrist_mix(++solves);
+    es.deadline = deadline;
+    uint64_t free = r->count == 64 ? ~0ULL : (1ULL << r->count) - 1;
+    uint64_t side = r->reach[owner], other = r->reach[!owner];
+
+    // MTD(f): null-window searches from the race estimate close in on the exact value
+    // and the move comes from the last search that proved a lower bound
+    int best = -1, guess = endgame_voronoi(r, free, side, other), lower = -64, upper = 64;
+    while (lower < upper && !es.aborted) {
+        int beta = guess == lower ? guess + 1 : guess, move;
+        guess = endgame_search(&es, r, free, side, other, beta - 1, beta, &move);
+        if (guess < beta) {
+            upper = guess;
+        } else {
+            lower = guess;
+            best = move;
+        }
+    }
+    *value = guess;
+    *cell = best >= 0 ? r->cell[best] : -1;
+    *nodes = es.nodes;
+    return !es.aborted;
+}
+
+/* ################################################################################# */
+
+/* #############  DECISION ################################################### */
+
+// Function to pick owner's GROW once every contested region is small enough to solve.
+// Each region is solved twice, owner first and opponent first, and the move goes to
+// the region where having the move is worth the most. Returns false (search instead)
+// while a large or wide-open region is still contested, on timeout, or when BASIC is
+// unaffordable.
+bool endgame_move(const SimState *s, int owner, double deadline, uint32_t *move) {
+    static EndgameRegion regions[16];
+    static TransTable table;
+    bool all_small;
+    int count = endgame_regions(&s->grid, regions, 16, &all_small);
+    if (count == 0 || !all_small || !sim_can_afford(s, owner, ORGAN_BASIC)) {
+        return false;
+    }
+    if (table.buckets == NULL && !tt_init(&table, (size_t)ENDGAME_TT_MB << 20)) {
+        return false;
+    }
+    tt_new_generation(&table);
+
+    int best_cell = -1, best_gain = 0;
+    long nodes = 0;
+    for (int i = 0; i < count; i++) {
+        int first_cell, first, second_cell, second;
+        long n1, n2;
+        int left = 2 * (count - i); // solves still to run share what remains of the budget
+        if (!endgame_solve(&table, &regions[i], owner, now_ms() + (deadline - now_ms()) / left, &first_cell, &first,
+                           &n1) ||
+            !endgame_solve(&table, &regions[i], !owner, now_ms() + (deadline - now_ms()) / (left - 1), &second_cell,
+                           &second, &n2)) {
+            return false;
+        }
+        nodes += n1 + n2;
+        int gain = first + second; // owner's margin moving first minus moving second
+        if (first_cell >= 0 && (best_cell < 0 || gain > best_gain)) {
+            best_cell = first_cell;
+            best_gain = gain;
+        }
+    }
+    if (best_cell < 0) {
+        return false;
+    }
+
+    for (int d = 0; d < 4; d++) {
+        int from = grid_nb[best_cell][d];
+        int piece = s->grid.piece[from];
+        if (piece_is_organ(piece) && piece_owner(piece) == owner) {
+            *move = move_encode(from, best_cell, ORGAN_BASIC, 0);
+            fprintf(stderr, "endgame: %d regions, gain %d, %ld nodes\n", count, best_gain, nodes);
+            tt_report(&table, stderr);
+            return true;
+        }
+    }
+    return false;
+}
+
+/* ################################################################################# */
+
+#endif
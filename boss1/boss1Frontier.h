@@ -0,0 +1,121 @@
+#ifndef BOSS1_FRONTIER_H
+#define BOSS1_FRONTIER_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+
+// Growth frontier of one owner: the free cells next to at least one of its organs,
+// where every GROW lands. Each cell counts its adjacent organs of the owner, and the
+// frontier is kept as a bitboard plus a dense list with a position index, so that
+// membership is one bit test and insert / remove are O(1). Only a change of occupancy
+// touches it, through frontier_update(), and the cost of reading it follows the
+// organisms' surface rather than the grid size or the entity count.
+
+typedef struct {
+    Bitboard cells;
+    int16_t count;
+    int16_t cell[GRID_CELLS];         // the frontier, in no particular order
+    int16_t pos[GRID_CELLS];          // cell -> index in cell[], valid while in the frontier
+    uint8_t touch[GRID_CELLS];        // adjacent organs of the owner, for every cell
+} Frontier;
+
+/* #############  SET ######################################################## */
+
+static inline bool frontier_has(const Frontier *f, int idx) { return bb_test(&f->cells, idx); }
+
+static inline void frontier_insert(Frontier *f, int idx) {
+    if (!bb_test(&f->cells, idx)) {
+        bb_set(&f->cells, idx);
+        f->pos[idx] = f->count;
+        f->cell[f->count++] = (int16_t)idx;
+    }
+}
+
+// Function to remove a cell by moving the last one into its place
+static inline void frontier_remove(Frontier *f, int idx) {
+    if (bb_test(&f->cells, idx)) {
+        bb_reset(&f->cells, idx);
+        int last = f->cell[--f->count];
+        f->cell[f->pos[idx]] = (int16_t)last;
+        f->pos[last] = f->pos[idx];
+    }
+}
+
+/* ################################################################################# */
+
+/* #############  MAINTENANCE ################################################ */
+
+// Function to build both owners' frontiers from scratch, indexed by owner
+void frontier_build(Frontier f[2], const Grid *g) {
+    for (int o = 0; o < 2; o++) {
+        bb_clear(&f[o].cells);
+        f[o].count = 0;
+        memset(f[o].touch, 0, sizeof(f[o].touch));
+    }
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        int piece = g->piece[idx];
+        if (piece_is_organ(piece)) {
+            for (int d = 0; d < 4; d++) {
+                f[piece_owner(piece)].touch[grid_nb[idx][d]]++;
+            }
+        }
+    }
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        for (int o = 0; o < 2; o++) {
+            if (f[o].touch[idx] && piece_is_free(g->piece[idx])) {
+                frontier_insert(&f[o], idx);
+            }
+        }
+    }
+}
+
+// Function to follow one cell going from old_piece to the piece now on the grid
+void frontier_update(Frontier f[2], const Grid *g, int idx, int old_piece) {
+    int piece = g->piece[idx];
+    if (piece_is_organ(old_piece)) {
+        Frontier *of = &f[piece_owner(old_piece)];
+        for (int d = 0; d < 4; d++) {
+            int nb = grid_nb[idx][d];
+            if (--of->touch[nb] == 0) {
+                frontier_remove(of, nb);
+            }
+        }
+    }
+    if (piece_is_organ(piece)) {
+        Frontier *nf = &f[piece_owner(piece)];
+        for (int d = 0; d < 4; d++) {
+            int nb = grid_nb[idx][d];
+            if (nf->touch[nb]++ == 0 && piece_is_free(g->piece[nb])) {
+                frontier_insert(nf, nb);
+            }
+        }
+    }
+    for (int o = 0; o < 2; o++) {
+        if (f[o].touch[idx] && piece_is_free(piece)) {
+            frontier_insert(&f[o], idx);
+        } else {
+            frontier_remove(&f[o], idx);
+        }
+    }
+}
+
+// Function to find an organ of owner next to a frontier cell, scanning N, E, S, W;
+// -1 if the cell is not on owner's frontier
+static inline int frontier_parent(const Grid *g, int owner, int idx) {
+    for (int d = 0; d < 4; d++) {
+        int nb = grid_nb[idx][d];
+        if (piece_is_organ(g->piece[nb]) && piece_owner(g->piece[nb]) == owner) {
+            return nb;
+        }
+    }
+    return -1;
+}
+
+/* ################################################################################# */
+
+#endif
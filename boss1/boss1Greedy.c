@@ -0,0 +1,39 @@
+#include "boss1Core.h"
+#include "boss1Sim.h"
+#include "boss1Greedy.h"
+#include "boss1Log.h"
+#include "boss1Strategy.h"
+
+// Bot that plays the parameterised greedy strategy.
+//
+//   gcc -O2 -o boss1Greedy boss1Greedy.c
+//   BOSS1_PARAMS="open=6,harvester=20" ./boss1Greedy
+
+static Params greedy_bot_params;
+
+static bool greedy_bot_begin(void) {
+    zobrist_init(1);
+    params_from_env(&greedy_bot_params);
+    params_print(&greedy_bot_params, stderr);
+    return true;
+}
+
+static void greedy_bot_decide(GameState *gameState, int turn) {
+    static SimState state;
+
+    sim_load(&state, gameState);
+    state.turn = turn;
+    uint32_t move = greedy_move(&state, ME, &greedy_bot_params);
+
+    // One action for the first organism, WAIT for the others
+    sim_print_move(&state, move);
+    strategy_wait_rest(gameState, 1);
+}
+
+const Strategy strategy_greedy = {"greedy", "one-ply greedy on the scoring layers (BOSS1_PARAMS)", false,
+                                  greedy_bot_begin, greedy_bot_decide, NULL};
+
+/* ############# Program Starts Here ############################################### */
+#ifndef BOSS1_NO_MAIN
+int main() { return strategy_run(&strategy_greedy); }
+#endif
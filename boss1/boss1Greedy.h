@@ -0,0 +1,93 @@
+#ifndef BOSS1_GREEDY_H
+#define BOSS1_GREEDY_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+#include "boss1Sim.h"
+#include "boss1DistField.h"
+#include "boss1Score.h"
+#include "boss1Params.h"
+#include "boss1Choke.h"
+
+// One-ply greedy strategy driven entirely by the parameter vector: the scoring kernel
+// ranks the free cells next to our organs, and the best few are tried as BASIC and
+// as every harvester that would face a protein; a cell that is a chokepoint of the open
+// area adds the cells it seals off, at the cut weight. The threat layer comes from one
+// incremental threat map per owner. Cheap enough to play whole self-play games in about
+// a millisecond, which is what the tuner needs.
+
+#define GREEDY_TOP_K 8
+
+// Function to pick owner's GROW for this turn, or MOVE_WAIT
+uint32_t greedy_move(const SimState *s, int owner, const Params *p) {
+    static DistField field;
+    static ScoreBoard board;
+    static ChokeMap choke;
+    static int choke_turn = -1;       // turn the choke map was last synced on, -1 before any
+    static ThreatMap threats[2];      // per owner, the opponent's tentacles
+    static int threat_turn = -1;
+    const Grid *g = &s->grid;
+
+    dist_field_build(&field, g);
+    if (threat_turn < 0 || s->turn < threat_turn) {
+        threat_init(&threats[ME], g, OPP); // a new game
+        threat_init(&threats[OPP], g, ME);
+    }
+    threat_sync_grid(&threats[owner], g, s->proteins[!owner]);
+    threat_turn = s->turn;
+    if (p->v[PARAM_cut] != 0) {
+        if (choke_turn < 0 || s->turn < choke_turn) {
+            choke_init(&choke, g); // a new game: analyze its walls once
+        }
+        choke_sync(&choke, g); // incremental along a game, whichever owner asks
+        choke_turn = s->turn;
+    }
+    score_build(&board, g, &field, owner, &threats[owner]);
+    int16_t weight[SCORE_LAYERS];
+    weight[SCORE_LAYER_OPEN] = (int16_t)p->v[PARAM_open];
+    weight[SCORE_LAYER_TERRITORY] = (int16_t)p->v[PARAM_territory];
+    weight[SCORE_LAYER_PROTEIN] = (int16_t)p->v[PARAM_protein];
+    weight[SCORE_LAYER_THREAT] = (int16_t)p->v[PARAM_threat];
+    score_eval(&board, weight);
+
+    ScoredCell top[GREEDY_TOP_K];
+    int n = score_top_k(&board, GREEDY_TOP_K, top);
+    bool basic = sim_can_afford(s, owner, ORGAN_BASIC);
+    bool harvester = sim_can_afford(s, owner, ORGAN_HARVESTER);
+    uint32_t best = MOVE_WAIT;
+    int best_value = INT32_MIN;
+
+    for (int i = 0; i < n; i++) {
+        int to = top[i].cell;
+        int from = -1;
+        for (int d = 0; d < 4 && from < 0; d++) {
+            int nb = grid_nb[to][d];
+            if (piece_is_organ(g->piece[nb]) && piece_owner(g->piece[nb]) == owner) {
+                from = nb;
+            }
+        }
+        if (from < 0) {
+            continue;
+        }
+        int value = top[i].score + (piece_is_protein(g->piece[to]) ? p->v[PARAM_absorb] : 0) +
+                    (p->v[PARAM_cut] != 0 ? p->v[PARAM_cut] * choke_cut_area(&choke, to) : 0);
+        if (basic && value > best_value) {
+            best_value = value;
+            best = move_encode(from, to, ORGAN_BASIC, 0);
+        }
+        for (int d = 0; harvester && d < 4; d++) {
+            if (piece_is_protein(g->piece[grid_nb[to][d]]) && value + p->v[PARAM_harvester] > best_value) {
+                best_value = value + p->v[PARAM_harvester];
+                best = move_encode(from, to, ORGAN_HARVESTER, d);
+            }
+        }
+    }
+    return best;
+}
+
+#endif
@@ -0,0 +1,407 @@
+#ifndef BOSS1_HARVEST_H
+#define BOSS1_HARVEST_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+#include "boss1DistField.h"
+#include "boss1Params.h"
+
+// Harvester placement as weighted set cover. Every protein source is an element worth
+// its type's weight per turn of income; every (empty cell, facing) next to a source is
+// a set covering that source. A set's cost is the organs grown to reach it from the
+// organism plus those already planned, so placements that share a path are cheap together,
+// and income starts only once the organism (one GROW a turn) has built it.
+// A greedy pass picks the best gain per turn of growth; local search then drops, swaps
+// and replaces placements of the ordered plan until no move helps or time runs out.
+// Paths cross empty cells only, so no source is eaten on the way.
+
+#define HARVEST_MAX_CANDIDATES 512
+#define HARVEST_MAX_PLAN 6
+#define HARVEST_REACH 12              // sources farther than this from the organism are not considered
+#define HARVEST_DEPTH 16              // deepest path a placement may need
+
+typedef struct {
+    int16_t cell;                     // where the harvester grows
+    int16_t source;                   // the protein cell it faces
+    uint8_t dir;                      // facing, from cell to source
+    uint8_t type;                     // protein type of the source
+} HarvestCandidate;
+
+typedef struct {
+    int count;
+    int16_t pick[HARVEST_MAX_PLAN];   // candidate ids in build order
+    int value;                        // weighted income minus weighted cost, over the horizon
+    int step;                         // cell to grow this turn toward pick[0], -1 without a plan
+    int parent;                       // organ cell that step grows from
+    int type;                         // ORGAN_HARVESTER when step is the harvester cell, else ORGAN_BASIC
+    int dir;
+    long replays;                     // plan evaluations, for the report
+} HarvestPlan;
+
+typedef struct {
+    const Grid *grid;
+    Bitboard organs;                  // the organism before any planned growth
+    HarvestCandidate cand[HARVEST_MAX_CANDIDATES];
+    int cand_count;
+    Bitboard cand_cells;              // distinct cells of the candidates, where the BFS may stop
+    int weight[4];                    // value of one protein of each type
+    int basic_cost, harvester_cost;   // weighted cost of a BASIC and of a HARVESTER
+    int horizon;                      // turns of income still to come
+} HarvestProblem;
+
+/* #############  SETUP ###################################################### */
+
+// Function to weigh the protein types: scarce types, and types with no income yet, are
+// worth more per unit
+static void harvest_weights(const Params *p, const int stock[4], const int income[4], int weight[4]) {
+    for (int t = 0; t < 4; t++) {
+        weight[t] = p->v[PARAM_harvest_base] + p->v[PARAM_harvest_new] / (1 + income[t]) +
+                    (stock[t] < p->v[PARAM_low_stock] ? p->v[PARAM_harvest_low] : 0);
+    }
+}
+
+// Function to list the candidates for the organism made of organs[]; field limits them
+// to sources that organism can reach soon
+static void harvest_setup(HarvestProblem *hp, const Grid *grid, const DistField *field, const int *organs,
+                          int organ_count, int owner, const int stock[4], const Params *p) {
+    int income[4] = {0, 0, 0, 0};
+    static VisitMarks harvested;
+    int near[4] = {DIST_UNREACHED, DIST_UNREACHED, DIST_UNREACHED, DIST_UNREACHED};
+
+    hp->grid = grid;
+    hp->cand_count = 0;
+    hp->horizon = p->v[PARAM_horizon];
+    bb_clear(&hp->organs);
+    bb_clear(&hp->cand_cells);
+    visit_begin(&harvested);
+
+    // Sources our harvesters face already are covered
+    for (int c = 0; c < GRID_CELLS; c++) {
+        int piece = grid->piece[c];
+        if (piece_is_organ(piece) && piece_owner(piece) == owner && piece_organ_type(piece) == ORGAN_HARVESTER) {
+            int faced = grid_nb[c][piece_dir(piece)];
+            if (piece_is_protein(grid->piece[faced])) {
+                visit_set(&harvested, faced);
+                income[grid->piece[faced] - PIECE_PROTEIN]++;
+            }
+        }
+    }
+    for (int i = 0; i < organ_count; i++) {
+        bb_set(&hp->organs, organs[i]);
+        for (int d = 0; d < 4; d++) {
+            int s = grid_nb[organs[i]][d];
+            for (int t = 0; t < 4 && piece_is_free(grid->piece[s]); t++) {
+                int k = dist_field_get(field, s, t);
+                near[t] = k < near[t] ? k : near[t];
+            }
+        }
+    }
+
+    harvest_weights(p, stock, income, hp->weight);
+    hp->basic_cost = hp->harvester_cost = 0;
+    for (int t = 0; t < 4; t++) {
+        hp->basic_cost += organ_cost[ORGAN_BASIC][t] * hp->weight[t];
+        hp->harvester_cost += organ_cost[ORGAN_HARVESTER][t] * hp->weight[t];
+    }
+
+    for (int s = 0; s < GRID_CELLS && hp->cand_count < HARVEST_MAX_CANDIDATES; s++) {
+        int piece = grid->piece[s];
+        if (!piece_is_protein(piece) || visit_seen(&harvested, s) || near[piece - PIECE_PROTEIN] > HARVEST_REACH) {
+            continue;
+        }
+        for (int d = 0; d < 4 && hp->cand_count < HARVEST_MAX_CANDIDATES; d++) {
+            int cell = grid_nb[s][d];
+            if (grid->piece[cell] == PIECE_EMPTY) {
+                hp->cand[hp->cand_count++] = (HarvestCandidate){(int16_t)cell, (int16_t)s, (uint8_t)((d + 2) & 3),
+                                                                (uint8_t)(piece - PIECE_PROTEIN)};
+                bb_set(&hp->cand_cells, cell);
+            }
+        }
+    }
+}
+
+/* ################################################################################# */
+
+/* #############  EVALUATION ################################################# */
+
+// Function to run a BFS over empty cells from every cell of tree, HARVEST_DEPTH steps
+// deep, that stops once every cell of wanted is reached; dist is -1 where unreached and
+// from[] gives the cell each cell was entered from
+static void harvest_bfs(const Grid *grid, const Bitboard *tree, const Bitboard *wanted, int16_t dist[GRID_CELLS],
+                        int16_t from[GRID_CELLS]) {
+    static int queue[GRID_CELLS];
+    int front = 0, rear = 0;
+    int missing = bb_count(wanted);
+    memset(dist, -1, sizeof(int16_t) * GRID_CELLS);
+    BB_FOREACH(tree, c) {
+        dist[c] = 0;
+        from[c] = -1;
+        queue[rear++] = c;
+        missing -= bb_test(wanted, c);
+    }
+    while (front < rear && missing > 0) {
+        int c = queue[front++];
+        search_stats.nodes_expanded++;
+        for (int d = 0; d < 4 && dist[c] < HARVEST_DEPTH; d++) {
+            int n = grid_nb[c][d];
+            if (dist[n] < 0 && grid->piece[n] == PIECE_EMPTY && !bb_test(tree, n)) {
+                dist[n] = (int16_t)(dist[c] + 1);
+                from[n] = (int16_t)c;
+                queue[rear++] = n;
+                missing -= bb_test(wanted, n);
+            }
+        }
+    }
+}
+
+// Function to score one placement built after `built` turns of growth that needs k
+// more organs: its income until the horizon minus what the organs cost
+static inline int harvest_gain(const HarvestProblem *hp, const HarvestCandidate *c, int built, int k) {
+    int producing = hp->horizon - (built + k);
+    return hp->weight[c->type] * (producing > 0 ? producing : 0) - (k - 1) * hp->basic_cost - hp->harvester_cost;
+}
+
+// State of an ordered plan after its first placements: the organism and the paths
+// grown so far, the sources covered, the value and the organs it took
+typedef struct {
+    Bitboard tree;
+    Bitboard covered;
+    int value;
+    int built;
+} HarvestPrefix;
+
+static inline void harvest_prefix_start(const HarvestProblem *hp, HarvestPrefix *p) {
+    p->tree = hp->organs;
+    bb_clear(&p->covered);
+    p->value = p->built = 0;
+}
+
+// Function to add placement pick to a prefix along from[], the parents of a BFS from the
+// prefix's tree that reached the placement's cell k steps away
+static void harvest_grow(const HarvestProblem *hp, HarvestPrefix *p, int pick, int k, const int16_t *from) {
+    const HarvestCandidate *c = &hp->cand[pick];
+    p->value += harvest_gain(hp, c, p->built, k);
+    p->built += k;
+    bb_set(&p->covered, c->source);
+    for (int q = c->cell; q >= 0 && !bb_test(&p->tree, q); q = from[q]) {
+        bb_set(&p->tree, q);
+    }
+}
+
+// Function to build one more placement on a prefix; returns false if it cannot be built
+static bool harvest_extend(const HarvestProblem *hp, HarvestPrefix *p, int pick) {
+    static int16_t dist[GRID_CELLS], from[GRID_CELLS];
+    const HarvestCandidate *c = &hp->cand[pick];
+    Bitboard wanted;
+
+    if (bb_test(&p->covered, c->source)) {
+        return false;
+    }
+    bb_clear(&wanted);
+    bb_set(&wanted, c->cell);
+    harvest_bfs(hp->grid, &p->tree, &wanted, dist, from);
+    int k = dist[c->cell];
+    if (k <= 0) {
+        return false;
+    }
+    harvest_grow(hp, p, pick, k, from);
+    return true;
+}
+
+// Function to value the placements pick[] built one after the other on top of start;
+// returns INT32_MIN if one of them cannot be built any more
+static int harvest_replay(const HarvestProblem *hp, const HarvestPrefix *start, const int16_t *pick, int count,
+                          long *replays) {
+    HarvestPrefix p = *start;
+    (*replays)++;
+    for (int i = 0; i < count; i++) {
+        if (!harvest_extend(hp, &p, pick[i])) {
+            return INT32_MIN;
+        }
+    }
+    return p.value;
+}
+
+// Function to bound the value of building pick[] on top of p, when the first placement
+// is k organs away and the others take at least one organ each
+static int harvest_bound(const HarvestProblem *hp, const HarvestPrefix *p, const int16_t *pick, int count, int k) {
+    int bound = p->value, built = p->built;
+    for (int i = 0; i < count; i++) {
+        bound += harvest_gain(hp, &hp->cand[pick[i]], built, i == 0 ? k : 1);
+        built += i == 0 ? k : 1;
+    }
+    return bound;
+}
+
+/* ################################################################################# */
+
+/* #############  SOLVER ##################################################### */
+
+// Function to check, before any planning, that the organism made of organs[] can pay
+// for the first step of some plan: a BASIC toward a placement, or a HARVESTER grown
+// right next to the organism on a cell that faces a source
+bool harvest_can_start(const Grid *grid, const int *organs, int organ_count, const int stock[4]) {
+    bool basic = true, harvester = true;
+    for (int t = 0; t < 4; t++) {
+        basic &= stock[t] >= organ_cost[ORGAN_BASIC][t];
+        harvester &= stock[t] >= organ_cost[ORGAN_HARVESTER][t];
+    }
+    for (int i = 0; i < organ_count && !basic && harvester; i++) {
+        for (int d = 0; d < 4; d++) {
+            int cell = grid_nb[organs[i]][d];
+            for (int f = 0; f < 4 && grid->piece[cell] == PIECE_EMPTY; f++) {
+                if (piece_is_protein(grid->piece[grid_nb[cell][f]])) {
+                    return true;
+                }
+            }
+        }
+    }
+    return basic;
+}
+
+// Function to plan the harvesters of one organism: greedy by gain per grown organ, then
+// local search until the deadline. plan->step is the first GROW toward pick[0]; params
+// gives the horizon and the protein weights.
+//
+// prefix[i] is the plan's state before pick[i] and reach[i] the distances from its tree
+// to every candidate cell. A move at position i keeps the placements before it, so only
+// the rest is replayed, and only the prefixes from i on are rebuilt after it; the greedy
+// pass leaves both arrays valid for the plan it built.
+void harvest_plan(const Grid *grid, const DistField *field, const int *organs, int organ_count, int owner,
+                  const int stock[4], const Params *params, double deadline, HarvestPlan *plan) {
+    static HarvestProblem hp;
+    static HarvestPrefix prefix[HARVEST_MAX_PLAN + 1];
+    static int16_t reach[HARVEST_MAX_PLAN][GRID_CELLS];
+    static int16_t dist[GRID_CELLS], from[GRID_CELLS];
+    int16_t trial[HARVEST_MAX_PLAN];
+
+    memset(plan, 0, sizeof(*plan));
+    plan->step = plan->parent = -1;
+    harvest_setup(&hp, grid, field, organs, organ_count, owner, stock, params);
+
+    // Greedy: the placement with the best positive gain per organ grown, from the tree so far
+    harvest_prefix_start(&hp, &prefix[0]);
+    while (plan->count < HARVEST_MAX_PLAN && hp.cand_count > 0) {
+        const HarvestPrefix *p = &prefix[plan->count];
+        int16_t *d = reach[plan->count];
+        harvest_bfs(grid, &p->tree, &hp.cand_cells, d, from);
+        int best = -1;
+        double best_rate = 0.0;
+        for (int i = 0; i < hp.cand_count; i++) {
+            const HarvestCandidate *c = &hp.cand[i];
+            int k = d[c->cell];
+            if (k <= 0 || bb_test(&p->covered, c->source)) {
+                continue;
+            }
+            int gain = harvest_gain(&hp, c, p->built, k);
+            if (gain > 0 && (best < 0 || (double)gain / k > best_rate)) {
+                best = i;
+                best_rate = (double)gain / k;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+        prefix[plan->count + 1] = *p;
+        harvest_grow(&hp, &prefix[plan->count + 1], best, d[hp.cand[best].cell], from);
+        plan->pick[plan->count++] = (int16_t)best;
+    }
+    plan->value = prefix[plan->count].value;
+
+    // Local search over the ordered plan: drop, swap neighbors, replace with any other
+    // candidate; first improvement wins and the scan restarts
+    int fresh = plan->count; // prefix[i + 1] and reach[i] hold for i < fresh
+    for (bool improved = plan->count > 0; improved && now_ms() < deadline;) {
+        improved = false;
+        for (int i = fresh; i < plan->count; i++) {
+            harvest_bfs(grid, &prefix[i].tree, &hp.cand_cells, reach[i], from);
+            prefix[i + 1] = prefix[i];
+            harvest_grow(&hp, &prefix[i + 1], plan->pick[i], reach[i][hp.cand[plan->pick[i]].cell], from);
+        }
+        fresh = plan->count;
+        // A move is only replayed if its bound beats the plan
+        for (int i = 0; i < plan->count && !improved; i++) {
+            int n = plan->count - i - 1;
+            int k = n > 0 ? reach[i][hp.cand[plan->pick[i + 1]].cell] : 0;
+            if (harvest_bound(&hp, &prefix[i], plan->pick + i + 1, n, k) <= plan->value) {
+                continue;
+            }
+            int v = harvest_replay(&hp, &prefix[i], plan->pick + i + 1, n, &plan->replays);
+            if (v > plan->value) {
+                memmove(plan->pick + i, plan->pick + i + 1, sizeof(trial[0]) * n);
+                plan->count--;
+                plan->value = v;
+                fresh = i;
+                improved = true;
+            }
+        }
+        for (int i = 0; i + 1 < plan->count && !improved; i++) {
+            int n = plan->count - i;
+            memcpy(trial, plan->pick + i, sizeof(trial[0]) * n);
+            trial[0] = plan->pick[i + 1];
+            trial[1] = plan->pick[i];
+            if (harvest_bound(&hp, &prefix[i], trial, n, reach[i][hp.cand[trial[0]].cell]) <= plan->value) {
+                continue;
+            }
+            int v = harvest_replay(&hp, &prefix[i], trial, n, &plan->replays);
+            if (v > plan->value) {
+                memcpy(plan->pick + i, trial, sizeof(trial[0]) * n);
+                plan->value = v;
+                fresh = i;
+                improved = true;
+            }
+        }
+        for (int i = 0; i < plan->count && !improved && now_ms() < deadline; i++) {
+            int n = plan->count - i;
+            memcpy(trial, plan->pick + i, sizeof(trial[0]) * n);
+            for (int c = 0; c < hp.cand_count && !improved; c++) {
+                // A source already covered before or after position i makes the plan invalid
+                int k = reach[i][hp.cand[c].cell];
+                bool covered = c == plan->pick[i] || k <= 0 || bb_test(&prefix[i].covered, hp.cand[c].source);
+                for (int j = i + 1; j < plan->count && !covered; j++) {
+                    covered = hp.cand[plan->pick[j]].source == hp.cand[c].source;
+                }
+                if (covered) {
+                    continue;
+                }
+                trial[0] = (int16_t)c;
+                if (harvest_bound(&hp, &prefix[i], trial, n, k) <= plan->value) {
+                    continue;
+                }
+                int v = harvest_replay(&hp, &prefix[i], trial, n, &plan->replays);
+                if (v > plan->value) {
+                    memcpy(plan->pick + i, trial, sizeof(trial[0]) * n);
+                    plan->value = v;
+                    fresh = i;
+                    improved = true;
+                }
+            }
+        }
+    }
+
+    // First step toward the first placement
+    if (plan->count > 0) {
+        const HarvestCandidate *c = &hp.cand[plan->pick[0]];
+        Bitboard wanted;
+        bb_clear(&wanted);
+        bb_set(&wanted, c->cell);
+        harvest_bfs(grid, &hp.organs, &wanted, dist, from);
+        int step = c->cell;
+        while (from[step] >= 0 && !bb_test(&hp.organs, from[step])) {
+            step = from[step];
+        }
+        plan->step = step;
+        plan->parent = from[step];
+        plan->type = step == c->cell ? ORGAN_HARVESTER : ORGAN_BASIC;
+        plan->dir = step == c->cell ? c->dir : 0;
+    }
+}
+
+/* ################################################################################# */
+
+#endif
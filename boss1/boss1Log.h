@@ -0,0 +1,373 @@
+#ifndef BOSS1_LOG_H
+#define BOSS1_LOG_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "boss1Core.h"
+
+// Compact binary game log. A file is a static header (dimensions and the walls of the
+// first turn), then one record per turn holding the protein stocks, the cells that
+// changed since the previous turn and the action lines we sent, then an offset index.
+// Every LOG_KEYFRAME_INTERVAL turns the record is a full snapshot instead of a delta,
+// so any turn is rebuilt from at most LOG_KEYFRAME_INTERVAL records. The reader maps
+// the file and hands out pointers into it without copying.
+//
+//   BOSS1_LOG=game.b1log ./boss1DecidePathToA     # write a log while playing
+
+#define LOG_MAGIC 0x474C3142u         // "B1LG"
+#define LOG_VERSION 1
+#define LOG_KEYFRAME_INTERVAL 16
+#define LOG_MAX_CELLS (GRID_MAX_W * GRID_MAX_H)
+#define LOG_MAX_ACTION_BYTES 1024
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint8_t width;
+    uint8_t height;
+    uint32_t turn_count;              // 0 if the writer never closed the file
+    uint32_t keyframe_interval;
+    uint64_t index_offset;            // file offset of uint64_t offsets[turn_count]
+    uint8_t walls[(LOG_MAX_CELLS + 7) / 8]; // bit per map cell, y * width + x
+} LogHeader;
+
+typedef struct {
+    uint16_t cell;                    // y * width + x
+    uint8_t piece;                    // PIECE_* code, PIECE_EMPTY when a cell was cleared
+    uint8_t pad;
+    int16_t organ_id;
+    int16_t organ_parent_id;
+    int16_t organ_root_id;
+} LogCell;
+
+typedef struct {
+    uint32_t size;                    // bytes of the whole record, a multiple of 8
+    uint16_t turn;
+    uint8_t keyframe;                 // 1: cells is a full snapshot (minus header walls)
+    uint8_t required_actions_count;
+    int16_t proteins[2][4];           // indexed by owner (ME / OPP), then A..D
+    uint16_t cell_count;              // LogCell entries following this header
+    uint16_t action_bytes;            // action text following the cells, newline separated
+} LogTurn;
+
+static inline const LogCell *log_turn_cells(const LogTurn *t) { return (const LogCell *)(t + 1); }
+static inline const char *log_turn_actions(const LogTurn *t) { return (const char *)(log_turn_cells(t) + t->cell_count); }
+
+/* #############  WRITER ##################################################### */
+
+typedef struct {
+    FILE *file;
+    LogHeader header;
+    LogCell prev[LOG_MAX_CELLS];      // cell contents as of the last record
+    LogCell cur[LOG_MAX_CELLS];
+    LogTurn turn;                     // buffered until its actions are known
+    LogCell cells[LOG_MAX_CELLS];
+    char actions[LOG_MAX_ACTION_BYTES];
+    bool pending;
+    uint64_t *offsets;
+    uint32_t offsets_capacity;
+} LogWriter;
+
+// Function to fill one cell snapshot per map cell from the parsed turn
+static void log_snapshot(const GameState *gameState, LogCell *cells) {
+    int width = gameState->width;
+    for (int i = 0; i < width * gameState->height; i++) {
+        cells[i] = (LogCell){(uint16_t)i, PIECE_EMPTY, 0, 0, 0, 0};
+    }
+    for (int i = 0; i < gameState->entity_count; i++) {
+        const Entity *e = &gameState->entities[i];
+        LogCell *c = &cells[e->y * width + e->x];
+        c->piece = (uint8_t)piece_from_entity(e);
+        c->organ_id = (int16_t)e->organ_id;
+        c->organ_parent_id = (int16_t)e->organ_parent_id;
+        c->organ_root_id = (int16_t)e->organ_root_id;
+    }
+}
+
+static void log_flush_turn(LogWriter *w) {
+    if (!w->pending) {
+        return;
+    }
+    if (w->header.turn_count == w->offsets_capacity) {
+        w->offsets_capacity = w->offsets_capacity ? w->offsets_capacity * 2 : 128;
+        w->offsets = realloc(w->offsets, sizeof(uint64_t) * w->offsets_capacity);
+    }
+    w->offsets[w->header.turn_count++] = (uint64_t)ftell(w->file);
+
+    size_t body = sizeof(LogTurn) + sizeof(LogCell) * w->turn.cell_count + w->turn.action_bytes;
+    static const uint8_t zeros[8];
+    w->turn.size = (uint32_t)((body + 7) & ~(size_t)7);
+    fwrite(&w->turn, sizeof(LogTurn), 1, w->file);
+    fwrite(w->cells, sizeof(LogCell), w->turn.cell_count, w->file);
+    fwrite(w->actions, 1, w->turn.action_bytes, w->file);
+    fwrite(zeros, 1, w->turn.size - body, w->file);
+    fflush(w->file); // a bot killed by the referee still leaves every finished turn on disk
+    w->pending = false;
+}
+
+// Function to create the log file; the header is written with the first turn
+bool log_open(LogWriter *w, const char *path) {
+    memset(w, 0, sizeof(*w));
+    w->file = fopen(path, "wb");
+    return w->file != NULL;
+}
+
+// Function to record the state of a new turn (and flush the previous one)
+void log_write_turn(LogWriter *w, const GameState *gameState) {
+    if (w->file == NULL) {
+        return;
+    }
+    log_flush_turn(w);
+    int cell_total = gameState->width * gameState->height;
+    log_snapshot(gameState, w->cur);
+
+    if (w->header.magic == 0) { // first turn: static header from the initial walls
+        w->header.magic = LOG_MAGIC;
+        w->header.version = LOG_VERSION;
+        w->header.width = (uint8_t)gameState->width;
+        w->header.height = (uint8_t)gameState->height;
+        w->header.keyframe_interval = LOG_KEYFRAME_INTERVAL;
+        for (int i = 0; i < cell_total; i++) {
+            w->prev[i] = (LogCell){(uint16_t)i, PIECE_EMPTY, 0, 0, 0, 0};
+            if (w->cur[i].piece == PIECE_WALL) {
+                w->header.walls[i / 8] |= (uint8_t)(1 << (i % 8));
+                w->prev[i] = w->cur[i];
+            }
+        }
+        fwrite(&w->header, sizeof(LogHeader), 1, w->file);
+    }
+
+    LogTurn *t = &w->turn;
+    memset(t, 0, sizeof(*t));
+    t->turn = (uint16_t)w->header.turn_count;
+    t->keyframe = t->turn % LOG_KEYFRAME_INTERVAL == 0;
+    t->required_actions_count = (uint8_t)gameState->required_actions_count;
+    for (int k = 0; k < 4; k++) {
+        t->proteins[ME][k] = (int16_t)gameState->my_proteins[k];
+        t->proteins[OPP][k] = (int16_t)gameState->opp_proteins[k];
+    }
+    for (int i = 0; i < cell_total; i++) {
+        bool static_wall = (w->header.walls[i / 8] >> (i % 8)) & 1;
+        bool changed = memcmp(&w->cur[i], &w->prev[i], sizeof(LogCell)) != 0;
+        bool keep = t->keyframe ? (w->cur[i].piece != PIECE_EMPTY && !static_wall) : changed;
+        if (keep) {
+            w->cells[t->cell_count++] = w->cur[i];
+        }
+        w->prev[i] = w->cur[i];
+    }
+    w->pending = true;
+}
+
+// Function to append one action line to the current turn (use as action_hook)
+void log_write_action(LogWriter *w, const char *line) {
+    size_t len = strlen(line);
+    if (!w->pending || w->turn.action_bytes + len > LOG_MAX_ACTION_BYTES) {
+        return;
+    }
+    memcpy(w->actions + w->turn.action_bytes, line, len);
+    w->turn.action_bytes = (uint16_t)(w->turn.action_bytes + len);
+}
+
+// Function to write the last turn and the index, then patch the header
+void log_close(LogWriter *w) {
+    if (w->file == NULL) {
+        return;
+    }
+    log_flush_turn(w);
+    if (w->header.magic != 0) {
+        w->header.index_offset = (uint64_t)ftell(w->file);
+        fwrite(w->offsets, sizeof(uint64_t), w->header.turn_count, w->file);
+        fseek(w->file, 0, SEEK_SET);
+        fwrite(&w->header, sizeof(LogHeader), 1, w->file);
+    }
+    fclose(w->file);
+    free(w->offsets);
+    w->file = NULL;
+}
+
+static LogWriter game_log;
+
+static void game_log_hook(const char *line) {
+    log_write_action(&game_log, line);
+}
+
+// Function to start the bot's game log when BOSS1_LOG names a file; the bot then calls
+// log_write_turn(&game_log, ...) after parsing each turn and log_close(&game_log) at the end
+void game_log_start_from_env(void) {
+    const char *path = getenv("BOSS1_LOG");
+    if (path != NULL && log_open(&game_log, path)) {
+        action_hook = game_log_hook;
+    }
+}
+
+/* ################################################################################# */
+
+/* #############  READER ##################################################### */
+
+typedef struct {
+    const uint8_t *base;
+    size_t size;
+    const LogHeader *header;
+    const uint64_t *index;            // points into the file, or at scanned offsets
+    uint64_t *scanned;                // offsets rebuilt by a scan when the file was not closed
+    uint32_t turn_count;
+} LogReader;
+
+// Function to check that a record at offset lies inside the file, 8-byte aligned, with
+// its cells and action text inside its own size
+static bool log_record_valid(const LogReader *r, uint64_t offset) {
+    if (offset < sizeof(LogHeader) || offset % 8 != 0 || offset > r->size || r->size - offset < sizeof(LogTurn)) {
+        return false;
+    }
+    const LogTurn *t = (const LogTurn *)(r->base + offset);
+    return t->size >= sizeof(LogTurn) && t->size % 8 == 0 && t->size <= r->size - offset
+        && sizeof(LogTurn) + (size_t)t->cell_count * sizeof(LogCell) + t->action_bytes <= t->size;
+}
+
+// Function to map a log file read-only; falls back to scanning the records if the
+// writer never wrote the index (the bot was killed mid-game) or the index does not
+// point at valid records. The file is not trusted: the header's size and every
+// record are checked before a pointer into them is handed out.
+bool log_reader_open(LogReader *r, const char *path) {
+    memset(r, 0, sizeof(*r));
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(LogHeader)) {
+        if (fd >= 0) {
+            close(fd);
+        }
+        return false;
+    }
+    r->size = (size_t)st.st_size;
+    r->base = mmap(NULL, r->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (r->base == MAP_FAILED) {
+        r->base = NULL;
+        return false;
+    }
+    r->header = (const LogHeader *)r->base;
+    if (r->header->magic != LOG_MAGIC || r->header->version != LOG_VERSION || r->header->keyframe_interval == 0
+        || r->header->width == 0 || r->header->width > GRID_MAX_W || r->header->height == 0
+        || r->header->height > GRID_MAX_H) {
+        munmap((void *)r->base, r->size);
+        r->base = NULL;
+        return false;
+    }
+
+    uint64_t index_offset = r->header->index_offset, turn_count = r->header->turn_count;
+    if (turn_count > 0 && index_offset % 8 == 0 && index_offset <= r->size
+        && turn_count <= (r->size - index_offset) / 8) {
+        const uint64_t *index = (const uint64_t *)(r->base + index_offset);
+        uint32_t valid = 0;
+        while (valid < turn_count && log_record_valid(r, index[valid])) {
+            valid++;
+        }
+        if (valid == turn_count) {
+            r->index = index;
+            r->turn_count = (uint32_t)turn_count;
+            return true;
+        }
+    }
+    size_t capacity = 128, offset = sizeof(LogHeader);
+    r->scanned = malloc(sizeof(uint64_t) * capacity);
+    while (log_record_valid(r, offset)) {
+        const LogTurn *t = (const LogTurn *)(r->base + offset);
+        if (r->turn_count == capacity) {
+            capacity *= 2;
+            r->scanned = realloc(r->scanned, sizeof(uint64_t) * capacity);
+        }
+        r->scanned[r->turn_count++] = offset;
+        offset += t->size;
+    }
+    r->index = r->scanned;
+    return true;
+}
+
+void log_reader_close(LogReader *r) {
+    if (r->base != NULL) {
+        munmap((void *)r->base, r->size);
+    }
+    free(r->scanned);
+    memset(r, 0, sizeof(*r));
+}
+
+// Function to get the record of a turn without copying, NULL if out of range
+const LogTurn *log_reader_turn(const LogReader *r, uint32_t turn) {
+    return turn < r->turn_count ? (const LogTurn *)(r->base + r->index[turn]) : NULL;
+}
+
+// Function to rebuild the full cell contents of a turn from its keyframe and deltas;
+// false if a record names a cell off the map or a piece code that does not exist
+bool log_reader_cells(const LogReader *r, uint32_t turn, LogCell *cells) {
+    if (turn >= r->turn_count) {
+        return false;
+    }
+    int cell_total = r->header->width * r->header->height;
+    for (int i = 0; i < cell_total; i++) {
+        bool wall = (r->header->walls[i / 8] >> (i % 8)) & 1;
+        cells[i] = (LogCell){(uint16_t)i, wall ? PIECE_WALL : PIECE_EMPTY, 0, 0, 0, 0};
+    }
+    uint32_t first = turn - turn % r->header->keyframe_interval;
+    for (uint32_t k = first; k <= turn; k++) {
+        const LogTurn *t = log_reader_turn(r, k);
+        const LogCell *changes = log_turn_cells(t);
+        for (int i = 0; i < t->cell_count; i++) {
+            if (changes[i].cell >= cell_total || changes[i].piece >= PIECE_COUNT) {
+                return false;
+            }
+            cells[changes[i].cell] = changes[i];
+        }
+    }
+    return true;
+}
+
+// Function to rebuild a turn as the GameState the bot parsed, for replays
+bool log_reader_game_state(const LogReader *r, uint32_t turn, GameState *gameState) {
+    static LogCell cells[LOG_MAX_CELLS];
+    if (!log_reader_cells(r, turn, cells)) {
+        return false;
+    }
+    const LogTurn *t = log_reader_turn(r, turn);
+    gameState->width = r->header->width;
+    gameState->height = r->header->height;
+    gameState->entity_count = 0;
+    for (int i = 0; i < gameState->width * gameState->height; i++) {
+        int piece = cells[i].piece;
+        if (piece == PIECE_EMPTY) {
+            continue;
+        }
+        Entity *e = &gameState->entities[gameState->entity_count++];
+        *e = (Entity){i % gameState->width, i / gameState->width, "", -1, 0, "X", 0, 0};
+        if (piece == PIECE_WALL) {
+            strcpy(e->type, "WALL");
+        } else if (piece_is_protein(piece)) {
+            e->type[0] = (char)('A' + piece - PIECE_PROTEIN);
+            e->type[1] = '\0';
+        } else {
+            strcpy(e->type, organ_names[piece_organ_type(piece)]);
+            e->owner = piece_owner(piece);
+            e->organ_dir[0] = dir_chars[piece_dir(piece)];
+            e->organ_id = cells[i].organ_id;
+            e->organ_parent_id = cells[i].organ_parent_id;
+            e->organ_root_id = cells[i].organ_root_id;
+        }
+    }
+    for (int k = 0; k < 4; k++) {
+        gameState->my_proteins[k] = t->proteins[ME][k];
+        gameState->opp_proteins[k] = t->proteins[OPP][k];
+    }
+    gameState->required_actions_count = t->required_actions_count;
+    return true;
+}
+
+/* ################################################################################# */
+
+#endif
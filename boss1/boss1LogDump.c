@@ -0,0 +1,56 @@
+#include "boss1Core.h"
+#include "boss1Log.h"
+
+// Reader for the binary game logs written with BOSS1_LOG=<file>.
+//
+//   gcc -O2 -o boss1LogDump boss1LogDump.c
+//   ./boss1LogDump game.b1log            one summary line per turn
+//   ./boss1LogDump game.b1log 17         turn 17 as the stdin stream the bot read
+//   ./boss1LogDump game.b1log --scan     rebuild every turn and time it
+
+int main(int argc, char **argv) {
+    static LogReader reader;
+    static GameState gameState;
+
+    if (argc < 2 || !log_reader_open(&reader, argv[1])) {
+        fprintf(stderr, "usage: %s <log> [turn | --scan]\n", argv[0]);
+        return 1;
+    }
+
+    if (argc > 2 && strcmp(argv[2], "--scan") == 0) {
+        double start = now_ms();
+        long entities = 0;
+        for (uint32_t turn = 0; turn < reader.turn_count; turn++) {
+            if (!log_reader_game_state(&reader, turn, &gameState)) {
+                fprintf(stderr, "turn %u: corrupt record\n", turn);
+                return 1;
+            }
+            entities += gameState.entity_count;
+        }
+        double elapsed = now_ms() - start;
+        printf("%u turns, %ld entities, %.3f ms (%.2f us/turn), %zu bytes (%.0f bytes/turn)\n",
+               reader.turn_count, entities, elapsed, reader.turn_count ? elapsed * 1000 / reader.turn_count : 0.0,
+               reader.size, reader.turn_count ? (double)reader.size / reader.turn_count : 0.0);
+    } else if (argc > 2) {
+        if (!log_reader_game_state(&reader, (uint32_t)atoi(argv[2]), &gameState)) {
+            fprintf(stderr, "turn %s out of range (%u turns) or corrupt\n", argv[2], reader.turn_count);
+            return 1;
+        }
+        write_grid_size(stdout, &gameState); // a standalone stream the bot can replay
+        write_turn(stdout, &gameState);
+    } else {
+        printf("%dx%d, %u turns\n", reader.header->width, reader.header->height, reader.turn_count);
+        for (uint32_t turn = 0; turn < reader.turn_count; turn++) {
+            const LogTurn *t = log_reader_turn(&reader, turn);
+            printf("turn %3u %s %3u cells  A%d B%d C%d D%d | %.*s", turn, t->keyframe ? "key  " : "delta",
+                   t->cell_count, t->proteins[ME][0], t->proteins[ME][1], t->proteins[ME][2], t->proteins[ME][3],
+                   t->action_bytes, log_turn_actions(t));
+            if (t->action_bytes == 0) {
+                printf("\n");
+            }
+        }
+    }
+
+    log_reader_close(&reader);
+    return 0;
+}
@@ -0,0 +1,215 @@
+#ifndef BOSS1_MAP_H
+#define BOSS1_MAP_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+
+// Hand-drawn ASCII maps, one character per cell, blanks between cells optional:
+//
+//   '#' wall            'E' or '.' empty      'A' protein A, '1'..'4' proteins A..D
+//   'R' 'B' 'H' 'T' 'S'  our ROOT / BASIC / HARVESTER / TENTACLE / SPORER
+//   'r' 'b' 'h' 't' 's'  the same organs for the opponent
+//
+// map_read_ascii() turns a drawing into the GameState the referee would have sent:
+// organ ids go to roots first, in reading order, then to the other organs in BFS
+// order from their root, which also gives each organ its parent. A harvester faces
+// an adjacent protein if it has one; every other organ faces N. Both players start
+// with map_start_stock.
+
+static const char map_organ_chars[ORGAN_TYPES + 1] = "RBHTS";
+
+static const char *map_protein_names[4] = {"A", "B", "C", "D"};
+
+static const int map_start_stock[4] = {10, 0, 1, 1};   // both players' stock on turn 0
+
+// Function to read a drawing; returns false (with a message on stderr) if the map is
+// too large, uses an unknown character or has an organ not connected to a root
+bool map_read_ascii(FILE *in, GameState *gameState) {
+    static int owner_at[GRID_MAX_H][GRID_MAX_W];
+    static int type_at[GRID_MAX_H][GRID_MAX_W];
+    static int id_at[GRID_MAX_H][GRID_MAX_W];
+    char line[512];
+
+    memset(gameState, 0, sizeof(*gameState));
+    memset(owner_at, -1, sizeof(owner_at));   // rows shorter than the widest one stay empty
+    memset(type_at, -1, sizeof(type_at));
+    memset(id_at, 0, sizeof(id_at));
+    while (fgets(line, sizeof(line), in) != NULL) {
+        int x = 0;
+        for (char *c = line; *c != '\0' && *c != '\n' && *c != '\r'; c++) {
+            if (*c == ' ' || *c == '\t') {
+                continue;
+            }
+            if (x >= GRID_MAX_W || gameState->height >= GRID_MAX_H) {
+                fprintf(stderr, "map larger than %dx%d\n", GRID_MAX_W, GRID_MAX_H);
+                return false;
+            }
+            int y = gameState->height;
+            const char *organ = strchr(map_organ_chars, *c >= 'a' && *c <= 'z' ? *c - 'a' + 'A' : *c);
+            Entity *e = &gameState->entities[gameState->entity_count];
+            *e = (Entity){x, y, "", -1, 0, "X", 0, 0};
+            if (*c == '#') {
+                strcpy(e->type, "WALL");
+            } else if (*c == 'A' || (*c >= '1' && *c <= '4')) {
+                strcpy(e->type, map_protein_names[*c == 'A' ? 0 : *c - '1']);
+            } else if (organ != NULL && *organ != '\0') {
+                owner_at[y][x] = (*c >= 'a' && *c <= 'z') ? OPP : ME;
+                type_at[y][x] = (int)(organ - map_organ_chars);
+                strcpy(e->type, organ_names[type_at[y][x]]);
+                e->owner = owner_at[y][x];
+                strcpy(e->organ_dir, "N");
+            } else if (*c != 'E' && *c != '.') {
+                fprintf(stderr, "unknown map character '%c' at (%d, %d)\n", *c, x, y);
+                return false;
+            }
+            if (e->type[0] != '\0') {
+                gameState->entity_count++;
+            }
+            x++;
+        }
+        if (x > 0) {
+            gameState->width = x > gameState->width ? x : gameState->width;
+            gameState->height++;
+        }
+    }
+    if (gameState->height == 0) {
+        fprintf(stderr, "empty map\n");
+        return false;
+    }
+
+    memcpy(gameState->my_proteins, map_start_stock, sizeof(map_start_stock));
+    memcpy(gameState->opp_proteins, map_start_stock, sizeof(map_start_stock));
+
+    // Roots take the first ids; BFS from each root numbers its organs and sets parents
+    static Point queue[MAX_ENTITIES];
+    int front = 0, rear = 0, next_id = 1;
+    for (int i = 0; i < gameState->entity_count; i++) {
+        Entity *e = &gameState->entities[i];
+        if (e->owner != -1 && type_at[e->y][e->x] == ORGAN_ROOT) {
+            e->organ_id = e->organ_root_id = id_at[e->y][e->x] = next_id++;
+            gameState->required_actions_count += e->owner == ME;
+            queue[rear++] = (Point){e->x, e->y};
+        }
+    }
+    static int parent_at[GRID_MAX_H][GRID_MAX_W], root_at[GRID_MAX_H][GRID_MAX_W];
+    for (int i = 0; i < rear; i++) {
+        root_at[queue[i].y][queue[i].x] = id_at[queue[i].y][queue[i].x];
+        parent_at[queue[i].y][queue[i].x] = 0;
+    }
+    while (front < rear) {
+        Point p = queue[front++];
+        for (int d = 0; d < 4; d++) {
+            int nx = p.x + dir_dx[d], ny = p.y + dir_dy[d];
+            if (nx < 0 || nx >= gameState->width || ny < 0 || ny >= gameState->height || id_at[ny][nx] != 0 ||
+                owner_at[ny][nx] != owner_at[p.y][p.x] || type_at[ny][nx] <= ORGAN_ROOT) {
+                continue;
+            }
+            id_at[ny][nx] = next_id++;
+            parent_at[ny][nx] = id_at[p.y][p.x];
+            root_at[ny][nx] = root_at[p.y][p.x];
+            queue[rear++] = (Point){nx, ny};
+        }
+    }
+
+    for (int i = 0; i < gameState->entity_count; i++) {
+        Entity *e = &gameState->entities[i];
+        if (e->owner == -1 || type_at[e->y][e->x] == ORGAN_ROOT) {
+            continue;
+        }
+        if (id_at[e->y][e->x] == 0) {
+            fprintf(stderr, "organ at (%d, %d) is not connected to a root\n", e->x, e->y);
+            return false;
+        }
+        e->organ_id = id_at[e->y][e->x];
+        e->organ_parent_id = parent_at[e->y][e->x];
+        e->organ_root_id = root_at[e->y][e->x];
+    }
+
+    // Harvesters face the first adjacent protein
+    for (int i = 0; i < gameState->entity_count; i++) {
+        Entity *e = &gameState->entities[i];
+        if (e->owner == -1 || type_at[e->y][e->x] != ORGAN_HARVESTER) {
+            continue;
+        }
+        for (int j = 0; j < gameState->entity_count; j++) {
+            const Entity *p = &gameState->entities[j];
+            int dx = p->x - e->x, dy = p->y - e->y;
+            if (p->owner == -1 && strlen(p->type) == 1 && abs(dx) + abs(dy) == 1) {
+                for (int d = 0; d < 4; d++) {
+                    if (dir_dx[d] == dx && dir_dy[d] == dy) {
+                        e->organ_dir[0] = dir_chars[d];
+                    }
+                }
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+// Function to read a drawing from a file
+bool map_load_ascii(const char *filename, GameState *gameState) {
+    FILE *file = fopen(filename, "r");
+    if (file == NULL) {
+        perror(filename);
+        return false;
+    }
+    bool ok = map_read_ascii(file, gameState);
+    fclose(file);
+    return ok;
+}
+
+static inline uint32_t map_rand(uint64_t *rng) {
+    *rng ^= *rng << 13;
+    *rng ^= *rng >> 7;
+    *rng ^= *rng << 17;
+    return (uint32_t)(*rng >> 11);
+}
+
+// Function to generate a point-symmetric start position, our root in the left half
+// and the opponent's mirrored into the right half
+void map_random(GameState *gameState, uint64_t *rng) {
+    int width = 16 + 2 * (int)(map_rand(rng) % 5), height = 8 + (int)(map_rand(rng) % 5);
+    width = width > GRID_MAX_W ? GRID_MAX_W : width;
+    height = height > GRID_MAX_H ? GRID_MAX_H : height;
+
+    memset(gameState, 0, sizeof(*gameState));
+    gameState->width = width;
+    gameState->height = height;
+    int root_x = 1 + (int)(map_rand(rng) % 3), root_y = 1 + (int)(map_rand(rng) % (height - 2));
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width / 2; x++) {
+            int r = (int)(map_rand(rng) % 100);
+            const char *type = r < 12 ? "WALL" : r < 16 ? "A" : r < 18 ? "B" : r < 20 ? "C" : r < 22 ? "D" : NULL;
+            if (x == root_x && y == root_y) {
+                type = "ROOT";
+            } else if (abs(x - root_x) + abs(y - root_y) == 1) {
+                type = NULL; // leave the root room to grow
+            }
+            if (type == NULL) {
+                continue;
+            }
+            for (int side = 0; side < 2; side++) {
+                Entity *e = &gameState->entities[gameState->entity_count++];
+                int ex = side ? width - 1 - x : x, ey = side ? height - 1 - y : y;
+                *e = (Entity){ex, ey, "", -1, 0, "X", 0, 0};
+                strcpy(e->type, type);
+                if (strcmp(type, "ROOT") == 0) {
+                    e->owner = side ? OPP : ME;
+                    e->organ_id = e->organ_root_id = side + 1;
+                    strcpy(e->organ_dir, "N");
+                }
+            }
+        }
+    }
+    memcpy(gameState->my_proteins, map_start_stock, sizeof(map_start_stock));
+    memcpy(gameState->opp_proteins, map_start_stock, sizeof(map_start_stock));
+    gameState->required_actions_count = 1;
+}
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef BOSS1_ORGANISM_H
+#define BOSS1_ORGANISM_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+
+// Organism trees rebuilt from each turn's organ_parent_id / organ_root_id. Organs are
+// numbered into slots; an id -> slot hash, child lists and a preorder listing make
+// "all organs of root R" and "everything that dies with organ X" a contiguous range
+// of order[], returned in O(1) and read in O(size of the result).
+
+#define ORGANISM_HASH 1024            // power of two, well above MAX_ENTITIES
+#define ORGANISM_NONE -1
+
+typedef struct {
+    int count;                        // organs of both owners
+    int root_count;
+    int16_t entity[MAX_ENTITIES];     // slot -> index in GameState.entities
+    int id[MAX_ENTITIES];             // slot -> organ id
+    int16_t parent[MAX_ENTITIES];     // parent slot, ORGANISM_NONE for roots (and orphans)
+    int16_t first_child[MAX_ENTITIES];
+    int16_t next_sibling[MAX_ENTITIES];
+    int16_t subtree_size[MAX_ENTITIES];
+    int16_t pre[MAX_ENTITIES];        // position of the slot in order[]
+    int16_t order[MAX_ENTITIES];      // slots in preorder, one tree after another
+    int16_t roots[MAX_ENTITIES];      // root slots, in entity order
+    int16_t table[ORGANISM_HASH];     // open addressing: slot + 1, 0 for empty
+} OrganismIndex;
+
+static inline unsigned organism_hash(int id) { return ((unsigned)id * 2654435761u) >> 22; }
+
+// Function to find the slot of an organ id, ORGANISM_NONE if no such organ is alive
+static inline int organism_slot(const OrganismIndex *ix, int id) {
+    for (unsigned h = organism_hash(id);; h = (h + 1) & (ORGANISM_HASH - 1)) {
+        int slot = ix->table[h] - 1;
+        if (slot < 0 || ix->id[slot] == id) {
+            return slot;
+        }
+    }
+}
+
+// Function to index this turn's organs; parents that are not on the map make their
+// children roots of their own trees, so a partial state still indexes every organ
+void organism_index_build(OrganismIndex *ix, const GameState *gameState) {
+    ix->count = 0;
+    ix->root_count = 0;
+    memset(ix->table, 0, sizeof(ix->table));
+    for (int i = 0; i < gameState->entity_count; i++) {
+        const Entity *e = &gameState->entities[i];
+        if (e->owner == -1 || e->organ_id <= 0) {
+            continue;
+        }
+        int slot = ix->count++;
+        ix->entity[slot] = (int16_t)i;
+        ix->id[slot] = e->organ_id;
+        ix->first_child[slot] = ORGANISM_NONE;
+        ix->subtree_size[slot] = 1;
+        unsigned h = organism_hash(e->organ_id);
+        while (ix->table[h] != 0) {
+            h = (h + 1) & (ORGANISM_HASH - 1);
+        }
+        ix->table[h] = (int16_t)(slot + 1);
+    }
+
+    // Children are pushed in reverse so each list keeps entity order
+    for (int slot = ix->count - 1; slot >= 0; slot--) {
+        const Entity *e = &gameState->entities[ix->entity[slot]];
+        int parent = e->organ_parent_id > 0 ? organism_slot(ix, e->organ_parent_id) : ORGANISM_NONE;
+        ix->parent[slot] = (int16_t)parent;
+        if (parent != ORGANISM_NONE) {
+            ix->next_sibling[slot] = ix->first_child[parent];
+            ix->first_child[parent] = (int16_t)slot;
+        }
+    }
+
+    // Preorder listing with an explicit stack; sizes fold up in reverse preorder
+    int count = 0;
+    static int16_t stack[MAX_ENTITIES];
+    for (int slot = 0; slot < ix->count; slot++) {
+        if (ix->parent[slot] != ORGANISM_NONE) {
+            continue;
+        }
+        ix->roots[ix->root_count++] = (int16_t)slot;
+        int top = 0;
+        stack[top++] = (int16_t)slot;
+        while (top > 0) {
+            int s = stack[--top];
+            ix->pre[s] = (int16_t)count;
+            ix->order[count++] = (int16_t)s;
+            int children = top;
+            for (int c = ix->first_child[s]; c != ORGANISM_NONE; c = ix->next_sibling[c]) {
+                stack[top++] = (int16_t)c;
+            }
+            for (int a = children, b = top - 1; a < b; a++, b--) { // first child on top
+                int16_t t = stack[a];
+                stack[a] = stack[b];
+                stack[b] = t;
+            }
+        }
+    }
+    for (int i = count - 1; i >= 0; i--) {
+        int s = ix->order[i];
+        if (ix->parent[s] != ORGANISM_NONE) {
+            ix->subtree_size[ix->parent[s]] += ix->subtree_size[s];
+        }
+    }
+}
+
+// Organs that die with slot (itself and every descendant), in preorder
+static inline const int16_t *organism_subtree(const OrganismIndex *ix, int slot, int *count) {
+    *count = ix->subtree_size[slot];
+    return &ix->order[ix->pre[slot]];
+}
+
+// Organs of the organism rooted at root_id, root first; NULL if there is no such root
+static inline const int16_t *organism_organs(const OrganismIndex *ix, int root_id, int *count) {
+    int slot = organism_slot(ix, root_id);
+    if (slot == ORGANISM_NONE || ix->parent[slot] != ORGANISM_NONE) {
+        *count = 0;
+        return NULL;
+    }
+    return organism_subtree(ix, slot, count);
+}
+
+static inline const Entity *organism_entity(const OrganismIndex *ix, const GameState *gameState, int slot) {
+    return &gameState->entities[ix->entity[slot]];
+}
+
+#endif
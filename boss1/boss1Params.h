@@ -0,0 +1,156 @@
+#ifndef BOSS1_PARAMS_H
+#define BOSS1_PARAMS_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// The heuristic weights as one parameter vector. Defaults are compiled in; at run time
+// BOSS1_PARAMS overrides any of them ("open=5,threat=12"), which is how the tuner
+// plays candidate vectors against each other. The tuner writes its winner to
+// boss1ParamsTuned.h, and a build that finds that file uses it as the defaults.
+//
+// Each parameter names the strategy that reads it: the greedy strategy's scoring
+// weights, and the harvest, spore and search settings of the shipped pathToA bot. The
+// tuner only moves the parameters of the strategy it plays.
+
+// X(name, default, min, max, strategy, meaning)
+#define PARAM_LIST(X) \
+    X(open,          4,   0,  32, "greedy",  "weight of free neighbors around the new organ") \
+    X(territory,     2,   0,  32, "greedy",  "weight of cells we reach before the opponent") \
+    X(protein,       3,   0,  32, "greedy",  "weight of closeness to the nearest protein") \
+    X(threat,        8,   0,  64, "greedy",  "penalty per enemy tentacle facing the cell") \
+    X(absorb,       -6, -60,  60, "greedy",  "bonus for growing onto a protein, which uses the source up") \
+    X(harvester,    12,   0, 120, "greedy",  "bonus for a harvester that faces a protein") \
+    X(cut,           1,  -8,   8, "greedy",  "weight per open cell a growth seals off from the largest open area") \
+    X(horizon,      40,   4, 100, "pathToA", "turns of income a harvester plan is valued over") \
+    X(harvest_base,  2,   0,  16, "pathToA", "value of one protein of any type in a harvester plan") \
+    X(harvest_new,   6,   0,  32, "pathToA", "value added to a protein, divided by 1 + the type's income") \
+    X(harvest_low,   2,   0,  16, "pathToA", "value added to a protein of a type short in stock") \
+    X(low_stock,     2,   0,  10, "pathToA", "stock below which a type is short") \
+    X(spore_saving,  3,   0,  20, "pathToA", "turns a spore must save over growing before it is worth a ROOT") \
+    X(search_order, 23,   0,  23, "pathToA", "neighbor order of the A search as a permutation index, 23 = W S E N")
+
+enum {
+#define PARAM_ENUM(name, def, lo, hi, strategy, meaning) PARAM_##name,
+    PARAM_LIST(PARAM_ENUM)
+#undef PARAM_ENUM
+    PARAM_COUNT
+};
+
+typedef struct {
+    int v[PARAM_COUNT];
+} Params;
+
+#define PARAM_FIELD(name, def, lo, hi, strategy, meaning) #name,
+static const char *param_names[PARAM_COUNT] = {PARAM_LIST(PARAM_FIELD)};
+#undef PARAM_FIELD
+#define PARAM_FIELD(name, def, lo, hi, strategy, meaning) lo,
+static const int param_min[PARAM_COUNT] = {PARAM_LIST(PARAM_FIELD)};
+#undef PARAM_FIELD
+#define PARAM_FIELD(name, def, lo, hi, strategy, meaning) hi,
+static const int param_max[PARAM_COUNT] = {PARAM_LIST(PARAM_FIELD)};
+#undef PARAM_FIELD
+#define PARAM_FIELD(name, def, lo, hi, strategy, meaning) strategy,
+static const char *param_strategy[PARAM_COUNT] = {PARAM_LIST(PARAM_FIELD)};
+#undef PARAM_FIELD
+
+#if defined(__has_include)
+#if __has_include("boss1ParamsTuned.h")
+#include "boss1ParamsTuned.h"
+#endif
+#endif
+
+#ifdef BOSS1_TUNED_PARAMS // written by boss1Tuner in PARAM_LIST order
+static const int param_defaults[PARAM_COUNT] = BOSS1_TUNED_PARAMS;
+#else
+#define PARAM_FIELD(name, def, lo, hi, strategy, meaning) def,
+static const int param_defaults[PARAM_COUNT] = {PARAM_LIST(PARAM_FIELD)};
+#undef PARAM_FIELD
+#endif
+
+static inline int param_clamp(int i, int value) {
+    return value < param_min[i] ? param_min[i] : value > param_max[i] ? param_max[i] : value;
+}
+
+// Function to decode a permutation index (0..23, in lexicographic order) into an
+// order of the four directions
+static inline void params_dir_order(int index, int order[4]) {
+    static const int block[4] = {6, 2, 1, 1};
+    int left[4] = {0, 1, 2, 3};
+    for (int i = 0; i < 4; i++) {
+        int k = index / block[i];
+        index %= block[i];
+        order[i] = left[k];
+        memmove(&left[k], &left[k + 1], sizeof(int) * (size_t)(3 - i - k));
+    }
+}
+
+// Function to tell whether the named strategy reads parameter i
+bool param_read_by(int i, const char *strategy) { return strcmp(param_strategy[i], strategy) == 0; }
+
+void params_default(Params *p) {
+    memcpy(p->v, param_defaults, sizeof(p->v));
+}
+
+// Function to apply "name=value" pairs separated by commas; returns false on an
+// unknown name or a malformed pair, leaving the pairs before it applied
+bool params_parse(Params *p, const char *text) {
+    while (text != NULL && *text != '\0') {
+        char name[32];
+        int value, used = 0;
+        if (sscanf(text, " %31[a-z_] = %d%n", name, &value, &used) != 2) {
+            return false;
+        }
+        int i = 0;
+        while (i < PARAM_COUNT && strcmp(param_names[i], name) != 0) {
+            i++;
+        }
+        if (i == PARAM_COUNT) {
+            return false;
+        }
+        p->v[i] = param_clamp(i, value);
+        text = strchr(text + used, ',');
+        text = text ? text + 1 : NULL;
+    }
+    return true;
+}
+
+// Function to load the defaults and apply BOSS1_PARAMS if it is set
+void params_from_env(Params *p) {
+    params_default(p);
+    const char *text = getenv("BOSS1_PARAMS");
+    if (text != NULL && !params_parse(p, text)) {
+        fprintf(stderr, "BOSS1_PARAMS: cannot parse \"%s\"\n", text);
+    }
+}
+
+// Function to print a vector in the BOSS1_PARAMS format
+void params_print(const Params *p, FILE *out) {
+    for (int i = 0; i < PARAM_COUNT; i++) {
+        fprintf(out, "%s%s=%d", i ? "," : "", param_names[i], p->v[i]);
+    }
+    fprintf(out, "\n");
+}
+
+// Function to write a vector as boss1ParamsTuned.h
+bool params_write_header(const Params *p, const char *filename, const char *comment) {
+    FILE *out = fopen(filename, "w");
+    if (out == NULL) {
+        perror(filename);
+        return false;
+    }
+    fprintf(out, "// Generated by boss1Tuner: %s\n// ", comment);
+    params_print(p, out);
+    fprintf(out, "#define BOSS1_TUNED_PARAMS {");
+    for (int i = 0; i < PARAM_COUNT; i++) {
+        fprintf(out, "%s%d", i ? ", " : "", p->v[i]);
+    }
+    fprintf(out, "}\n");
+    fclose(out);
+    return true;
+}
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef BOSS1_PATHTREE_H
+#define BOSS1_PATHTREE_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+
+// BFS parent trees packed as 2-bit directions: each reached cell stores the direction
+// of the cell it was entered from, 32 cells per 64-bit word, and a path is rebuilt by
+// following grid_nb[] from the target back to the root. A whole tree is under 100
+// bytes on the largest map, so one per organism and protein type stays in L1.
+//
+// Like the epoch visited marks, the codes are never cleared: a cell's code is only
+// meaningful if the search that filled the tree reached it, which holds along any
+// path it returned.
+
+#define PATH_TREE_WORDS ((GRID_CELLS * 2 + 63) / 64)
+
+typedef struct {
+    int root;                         // cell the search started from
+    uint64_t word[PATH_TREE_WORDS];
+} PathTree;
+
+static inline void path_tree_begin(PathTree *t, int root) { t->root = root; }
+
+// Function to record that cell idx was entered from its neighbor in direction dir
+static inline void path_tree_set(PathTree *t, int idx, int dir) {
+    int shift = (idx & 31) * 2;
+    t->word[idx >> 5] = (t->word[idx >> 5] & ~(3ULL << shift)) | (uint64_t)dir << shift;
+}
+
+// Direction from cell idx toward its parent
+static inline int path_tree_dir(const PathTree *t, int idx) { return (int)(t->word[idx >> 5] >> ((idx & 31) * 2)) & 3; }
+
+// Parent of cell idx, or -1 at the root
+static inline int path_tree_parent(const PathTree *t, int idx) {
+    return idx == t->root ? -1 : grid_nb[idx][path_tree_dir(t, idx)];
+}
+
+#endif
@@ -0,0 +1,177 @@
+#ifndef BOSS1_PERF_H
+#define BOSS1_PERF_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+
+// Opt-in hardware counter profiling of the decision loop. Built with -DBOSS1_PERF,
+// PERF_BEGIN(phase) / PERF_END(phase) read cycles, instructions, cache misses and branch
+// misses through Linux perf_event_open (one counter group, user space only) and add the
+// difference to the phase; perf_report() prints the totals and perf_reset() clears
+// them. Without BOSS1_PERF the macros compile to nothing. If the kernel refuses the counters (perf_event_paranoid,
+// containers, no PMU in a VM), phases still get call counts and wall time, and any
+// single event the CPU lacks is reported as "-".
+//
+// Phases may nest (TURN encloses the others); each read is a syscall, so keep phases
+// coarse and compare timings only between profiling builds.
+
+#define PERF_PHASE_LIST(X)                                                            \
+    X(TURN, "turn")           /* one whole decision */                                \
+    X(SETUP, "setup")         /* grid, organism index and per-turn tables */          \
+    X(SPORE, "spore")         /* spore planner */                                     \
+    X(HARVEST, "harvest")     /* harvester plan */                                    \
+    X(GROW, "grow")           /* BFS toward A and the fallback */                     \
+    X(SEARCH, "search")       /* tree search of the search bots */
+
+#define PERF_PHASE_ENUM(name, label) PERF_##name,
+enum { PERF_PHASE_LIST(PERF_PHASE_ENUM) PERF_PHASES };
+#undef PERF_PHASE_ENUM
+
+enum { PERF_CYCLES, PERF_INSTRUCTIONS, PERF_CACHE_MISSES, PERF_BRANCH_MISSES, PERF_EVENTS };
+
+#ifdef BOSS1_PERF
+
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+typedef struct {
+    uint64_t calls;
+    double ms;
+    uint64_t value[PERF_EVENTS];
+} PerfPhase;
+
+typedef struct {
+    bool tried;
+    int leader;                       // group leader fd, -1 when the counters are unavailable
+    int slot[PERF_EVENTS];            // position of each event in a group read, -1 if it failed to open
+    int opened;
+    uint64_t start[PERF_PHASES][PERF_EVENTS];
+    double start_ms[PERF_PHASES];
+    PerfPhase phase[PERF_PHASES];
+} PerfCounters;
+
+static PerfCounters perf;
+
+static const char *perf_phase_names[PERF_PHASES] = {
+#define PERF_PHASE_NAME(name, label) label,
+    PERF_PHASE_LIST(PERF_PHASE_NAME)
+#undef PERF_PHASE_NAME
+};
+
+// Function to open the counter group on first use; failures leave perf.leader at -1
+static void perf_open(void) {
+    static const uint64_t configs[PERF_EVENTS] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                  PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+    perf.tried = true;
+    perf.leader = -1;
+    perf.opened = 0;
+    for (int e = 0; e < PERF_EVENTS; e++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = configs[e];
+        attr.read_format = PERF_FORMAT_GROUP;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        int fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, perf.leader, 0);
+        perf.slot[e] = -1;
+        if (fd < 0) {
+            if (e == 0) {
+                fprintf(stderr, "perf: hardware counters unavailable, timing phases only\n");
+                return;
+            }
+            continue;
+        }
+        if (perf.leader < 0) {
+            perf.leader = fd;
+        }
+        perf.slot[e] = perf.opened++;
+    }
+}
+
+// Function to read every event of the group; zeros when unavailable
+static void perf_read(uint64_t value[PERF_EVENTS]) {
+    uint64_t buf[1 + PERF_EVENTS];
+    memset(value, 0, sizeof(uint64_t) * PERF_EVENTS);
+    if (perf.leader < 0 || read(perf.leader, buf, sizeof(buf)) < (ssize_t)sizeof(uint64_t)) {
+        return;
+    }
+    for (int e = 0; e < PERF_EVENTS; e++) {
+        if (perf.slot[e] >= 0 && (uint64_t)perf.slot[e] < buf[0]) {
+            value[e] = buf[1 + perf.slot[e]];
+        }
+    }
+}
+
+static inline void perf_begin(int phase) {
+    if (!perf.tried) {
+        perf_open();
+    }
+    perf_read(perf.start[phase]);
+    perf.start_ms[phase] = now_ms();
+}
+
+static inline void perf_end(int phase) {
+    uint64_t now[PERF_EVENTS];
+    perf_read(now);
+    PerfPhase *p = &perf.phase[phase];
+    p->calls++;
+    p->ms += now_ms() - perf.start_ms[phase];
+    for (int e = 0; e < PERF_EVENTS; e++) {
+        p->value[e] += now[e] - perf.start[phase][e];
+    }
+}
+
+// Function to zero the phase totals, e.g. between replay cases
+static inline void perf_reset(void) { memset(perf.phase, 0, sizeof(perf.phase)); }
+
+// Function to print the totals of every phase that ran
+static void perf_report(FILE *out) {
+    static const char *event_names[PERF_EVENTS] = {"cycles", "instr", "cache-miss", "branch-miss"};
+    fprintf(out, "perf %-8s %8s %10s", "phase", "calls", "ms");
+    for (int e = 0; e < PERF_EVENTS; e++) {
+        fprintf(out, " %13s", event_names[e]);
+    }
+    fprintf(out, " %6s\n", "IPC");
+    for (int ph = 0; ph < PERF_PHASES; ph++) {
+        const PerfPhase *p = &perf.phase[ph];
+        if (p->calls == 0) {
+            continue;
+        }
+        fprintf(out, "perf %-8s %8llu %10.3f", perf_phase_names[ph], (unsigned long long)p->calls, p->ms);
+        for (int e = 0; e < PERF_EVENTS; e++) {
+            if (perf.leader >= 0 && perf.slot[e] >= 0) {
+                fprintf(out, " %13llu", (unsigned long long)p->value[e]);
+            } else {
+                fprintf(out, " %13s", "-");
+            }
+        }
+        if (perf.leader >= 0 && p->value[PERF_CYCLES] > 0) {
+            fprintf(out, " %6.2f\n", (double)p->value[PERF_INSTRUCTIONS] / (double)p->value[PERF_CYCLES]);
+        } else {
+            fprintf(out, " %6s\n", "-");
+        }
+    }
+}
+
+#define PERF_BEGIN(phase) perf_begin(PERF_##phase)
+#define PERF_END(phase) perf_end(PERF_##phase)
+
+#else
+
+#define PERF_BEGIN(phase) ((void)0)
+#define PERF_END(phase) ((void)0)
+
+static inline void perf_reset(void) {}
+static inline void perf_report(FILE *out) { (void)out; }
+
+#endif
+
+#endif
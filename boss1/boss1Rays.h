@@ -0,0 +1,206 @@
+#ifndef BOSS1_RAYS_H
+#define BOSS1_RAYS_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+#include "boss1DistField.h"
+#include "boss1Symmetry.h"
+
+// Sporer ray tables for long-range ROOT expansion. A SPORER facing d shoots its spore
+// in a straight line, and the new ROOT can land on any free cell before the first wall
+// or organ. rays_init() lists every cell of every (cell, direction) ray up to the
+// walls, once per game (again only if a collision adds a wall); rays_mask() cuts each
+// ray at the first cell that is not free this turn; rays_sync() does both as needed.
+// On a symmetric map only the canonical cells' rays are listed: a cell of the other
+// half shares its image's ray, with the direction mapped, and rays_cell() maps every
+// cell read from it back through the symmetry.
+// The planner then scores every spore landing against the four distance fields
+// instead of walking the map one cell at a time.
+
+#define RAY_POOL (GRID_MAX_W * GRID_MAX_H * (GRID_MAX_W + GRID_MAX_H)) // >= w*h*(w+h-2) cells in all rays
+
+typedef struct {
+    int16_t start[GRID_CELLS][4];     // first cell of the ray in pool
+    uint8_t length[GRID_CELLS][4];    // cells before the first static wall
+    uint8_t open[GRID_CELLS][4];      // leading cells that are also free this turn
+    Bitboard walls;                   // the walls the rays were listed against
+    Symmetry sym;                     // of those walls
+    int16_t pool[RAY_POOL];
+} RayTable;
+
+typedef struct {
+    int parent;                       // organ that grows the sporer, -1 if the sporer stands already
+    int sporer;                       // sporer cell
+    int dir;                          // sporer facing
+    int landing;                      // cell of the new ROOT, -1 if there is no plan
+    int turns;                        // turns until the source is absorbed, sporer and spore included
+    int saving;                       // turns saved against growing to it
+} SporePlan;
+
+/* #############  TABLES ##################################################### */
+
+static bool rays_is_wall(int piece) { return piece == PIECE_WALL; }
+
+// Function to return cell k of the ray from c facing d
+static inline int rays_cell(const RayTable *rt, int c, int d, int k) {
+    int n = rt->pool[rt->start[c][d] + k];
+    return sym_is_canonical(&rt->sym, c) ? n : sym_cell(&rt->sym, n);
+}
+
+// Function to list the rays of every canonical cell of rt->sym against the walls of the
+// grid and point the other cells at their images' rays; returns the pool cells used
+int rays_list(RayTable *rt, const Grid *grid) {
+    int used = 0;
+    memset(rt->length, 0, sizeof(rt->length));
+    memset(rt->open, 0, sizeof(rt->open));
+    for (int c = 0; c < GRID_CELLS; c++) {
+        if (!sym_is_canonical(&rt->sym, c)) {
+            continue;
+        }
+        for (int d = 0; d < 4; d++) {
+            rt->start[c][d] = (int16_t)used;
+            if (grid->piece[c] == PIECE_WALL) {
+                continue;
+            }
+            for (int n = grid_nb[c][d]; grid->piece[n] != PIECE_WALL && used < RAY_POOL; n = grid_nb[n][d]) {
+                rt->pool[used++] = (int16_t)n;
+                rt->length[c][d]++;
+            }
+        }
+    }
+    for (int c = 0; c < GRID_CELLS; c++) {
+        if (!sym_is_canonical(&rt->sym, c)) {
+            int image = sym_cell(&rt->sym, c);
+            for (int d = 0; d < 4; d++) {
+                rt->start[c][d] = rt->start[image][sym_dir(&rt->sym, d)];
+                rt->length[c][d] = rt->length[image][sym_dir(&rt->sym, d)];
+            }
+        }
+    }
+    return used;
+}
+
+// Function to set up the table for the walls of the grid and their symmetry
+int rays_init(RayTable *rt, const Grid *grid) {
+    bb_from_grid(&rt->walls, grid, rays_is_wall);
+    symmetry_detect(&rt->sym, grid);
+    return rays_list(rt, grid);
+}
+
+// Function to cut every ray at the first organ (or collision wall) of this turn
+void rays_mask(RayTable *rt, const Grid *grid) {
+    for (int c = 0; c < GRID_CELLS; c++) {
+        for (int d = 0; d < 4; d++) {
+            int n = 0;
+            while (n < rt->length[c][d] && piece_is_free(grid->piece[rays_cell(rt, c, d, n)])) {
+                n++;
+            }
+            rt->open[c][d] = (uint8_t)n;
+        }
+    }
+}
+
+// Function to bring the table up to this turn: relist the rays if the walls changed
+// (a new game, or a collision), then mask them by this turn's organs
+void rays_sync(RayTable *rt, const Grid *grid) {
+    Bitboard walls;
+    bb_from_grid(&walls, grid, rays_is_wall);
+    if (memcmp(&walls, &rt->walls, sizeof(walls)) != 0) {
+        rays_init(rt, grid);
+    }
+    rays_mask(rt, grid);
+}
+
+// Function to count the cells a spore from cell c facing d can land on this turn; they
+// are rays_cell(rt, c, d, 0 .. count - 1)
+static inline int rays_landings(const RayTable *rt, int c, int d) { return rt->open[c][d]; }
+
+/* ################################################################################# */
+
+/* #############  PLANNER #################################################### */
+
+// Function to score the landings of one sporer position against every protein type
+static void rays_try(const RayTable *rt, const DistField *field, int parent, int sporer, int dir, int setup,
+                     SporePlan plan[4]) {
+    int count = rays_landings(rt, sporer, dir);
+    for (int i = 0; i < count; i++) {
+        int landing = rays_cell(rt, sporer, dir, i);
+        for (int t = 0; t < 4; t++) {
+            int k = dist_field_get(field, landing, t);
+            if (k == DIST_UNREACHED) {
+                continue;
+            }
+            int turns = setup + 1 + k; // the sporer if needed, the spore, then k grows onto the source
+            if (plan[t].landing < 0 || turns < plan[t].turns) {
+                plan[t] = (SporePlan){parent, sporer, dir, landing, turns, 0};
+            }
+        }
+    }
+}
+
+// Function to plan, for each protein type, the spore that reaches a source of that type
+// soonest from the organism made of organs[]: from a SPORER it already has, or from one
+// grown first onto a free cell next to its organs. plan[t].landing is -1 where no spore
+// is affordable or helps; saving is the turns gained over growing there from organs[].
+// rays_sync() and dist_field_build() must be current.
+void rays_plan(const RayTable *rt, const Grid *grid, const DistField *field, const int *organs, int organ_count,
+               const int stock[4], SporePlan plan[4]) {
+    bool spore = true, grow = true;
+    for (int t = 0; t < 4; t++) {
+        plan[t] = (SporePlan){-1, -1, 0, -1, 0, 0};
+        spore = spore && stock[t] >= organ_cost[ORGAN_ROOT][t];
+        grow = grow && stock[t] >= organ_cost[ORGAN_ROOT][t] + organ_cost[ORGAN_SPORER][t];
+    }
+    if (!spore) {
+        return;
+    }
+
+    int direct[4] = {DIST_UNREACHED, DIST_UNREACHED, DIST_UNREACHED, DIST_UNREACHED};
+    for (int i = 0; i < organ_count; i++) {
+        int c = organs[i], piece = grid->piece[c];
+        if (piece_organ_type(piece) == ORGAN_SPORER) {
+            rays_try(rt, field, -1, c, piece_dir(piece), 0, plan);
+        }
+        for (int d = 0; d < 4; d++) {
+            int s = grid_nb[c][d];
+            if (!piece_is_free(grid->piece[s])) {
+                continue;
+            }
+            for (int t = 0; t < 4; t++) {
+                int k = dist_field_get(field, s, t);
+                if (k != DIST_UNREACHED && 1 + k < direct[t]) {
+                    direct[t] = 1 + k;
+                }
+            }
+            for (int f = 0; grow && f < 4; f++) {
+                rays_try(rt, field, c, s, f, 1, plan);
+            }
+        }
+    }
+
+    for (int t = 0; t < 4; t++) {
+        plan[t].saving = direct[t] - plan[t].turns;
+        if (plan[t].landing >= 0 && plan[t].saving <= 0) {
+            plan[t].landing = -1;
+        }
+    }
+}
+
+// Function to print the first step of a plan: the SPORER grow, or the SPORE itself
+void rays_print_step(const Grid *grid, const SporePlan *plan) {
+    if (plan->parent >= 0) {
+        emit_action("GROW %d %d %d SPORER %c\n", grid->organ_id[plan->parent], grid_x(plan->sporer),
+                    grid_y(plan->sporer), dir_chars[plan->dir]);
+    } else {
+        emit_action("SPORE %d %d %d\n", grid->organ_id[plan->sporer], grid_x(plan->landing), grid_y(plan->landing));
+    }
+}
+
+/* ################################################################################# */
+
+#endif
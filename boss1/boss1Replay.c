@@ -0,0 +1,353 @@
+// Decision regression harness: replays recorded turn inputs through the bot and fails
+// on an illegal action, a wrong expected action, or a turn over its time or node budget.
+//
+//   gcc -O2 -o boss1Replay boss1Replay.c -lm && ./boss1Replay corpus/*.txt
+//   ./boss1Replay --strategy all corpus/*.txt
+//
+// A corpus case is the stdin stream the bot read (see boss1LogDump <log> <turn>),
+// preceded by directive lines:
+//
+//   # free text                          comment
+//   @max_ms 2.5                          per-turn decision time budget (best of the runs)
+//   @max_nodes 400                       per-turn budget of cells expanded by the searches
+//   @expect 0 GROW 1 * * BASIC           action line(s) of a turn, '*' matches any token
+//
+// Exit status is 0 when every case passes. The bot's stderr is muted unless -v.
+//
+// --strategy NAME replays another strategy of boss1Strategies.h, --strategy all every
+// one of them on the same inputs. The directives describe the default strategy, so the
+// others are held only to legal output and get their first action printed to compare.
+//
+// Built with -DBOSS1_PERF, every case is followed by the hardware counters of each
+// decision phase (boss1Perf.h), summed over the REPLAY_RUNS runs of all its turns.
+
+#define BOSS1_NO_MAIN
+#include "boss1Strategies.h"
+
+#define REPLAY_RUNS 5                 // each turn is timed this many times, the minimum counts
+#define REPLAY_MAX_EXPECT 32
+#define REPLAY_MAX_OUTPUT 4096
+
+typedef struct {
+    double max_ms;
+    long max_nodes;
+    int expect_count;
+    int expect_turn[REPLAY_MAX_EXPECT];
+    char expect[REPLAY_MAX_EXPECT][128];
+} ReplayCase;
+
+/* #############  LEGALITY ################################################### */
+
+// Function to compare an action line with a pattern token by token, '*' matching any token
+static bool action_matches(const char *line, const char *pattern) {
+    char a[128], b[128];
+    snprintf(a, sizeof(a), "%s", line);
+    snprintf(b, sizeof(b), "%s", pattern);
+    char *sa, *sb;
+    char *ta = strtok_r(a, " \t\r\n", &sa);
+    char *tb = strtok_r(b, " \t\r\n", &sb);
+    while (ta != NULL && tb != NULL) {
+        if (strcmp(tb, "*") != 0 && strcmp(ta, tb) != 0) {
+            return false;
+        }
+        ta = strtok_r(NULL, " \t\r\n", &sa);
+        tb = strtok_r(NULL, " \t\r\n", &sb);
+    }
+    return ta == NULL && tb == NULL;
+}
+
+// Function to check one action line against the turn state; prints the reason and
+// returns false if the referee would reject it. used_roots tracks organisms already
+// given an action this turn.
+static bool check_action(const GameState *gameState, const Grid *grid, int turn, const char *line, int *used_roots,
+                         int *used_count) {
+    int parent_id, x, y;
+    char type[16], dir[4] = "N";
+
+    if (strncmp(line, "WAIT", 4) == 0) {
+        return true;
+    }
+    bool spore = sscanf(line, "SPORE %d %d %d", &parent_id, &x, &y) == 3;
+    if (spore) {
+        strcpy(type, "ROOT");
+    } else if (sscanf(line, "GROW %d %d %d %15s %3s", &parent_id, &x, &y, type, dir) < 4) {
+        printf("    turn %d: malformed action: %s", turn, line);
+        return false;
+    }
+
+    const Entity *parent = NULL;
+    for (int i = 0; i < gameState->entity_count; i++) {
+        if (gameState->entities[i].owner == ME && gameState->entities[i].organ_id == parent_id) {
+            parent = &gameState->entities[i];
+        }
+    }
+    if (parent == NULL) {
+        printf("    turn %d: action from organ %d, which is not ours: %s", turn, parent_id, line);
+        return false;
+    }
+    for (int i = 0; i < *used_count; i++) {
+        if (used_roots[i] == parent->organ_root_id) {
+            printf("    turn %d: second action for organism %d: %s", turn, parent->organ_root_id, line);
+            return false;
+        }
+    }
+    used_roots[(*used_count)++] = parent->organ_root_id;
+
+    int organ = -1;
+    for (int t = spore ? ORGAN_ROOT : ORGAN_BASIC; t < ORGAN_TYPES; t++) {
+        if (strcmp(type, organ_names[t]) == 0) {
+            organ = t;
+        }
+    }
+    if (organ < 0 || dir[1] != '\0' || memchr(dir_chars, dir[0], sizeof(dir_chars)) == NULL) {
+        printf("    turn %d: unknown organ type or direction: %s", turn, line);
+        return false;
+    }
+    for (int p = 0; p < 4; p++) {
+        if (gameState->my_proteins[p] < organ_cost[organ][p]) {
+            printf("    turn %d: cannot afford %s: %s", turn, type, line);
+            return false;
+        }
+    }
+    if (!is_within_bounds(x, y, (GameState *)gameState) || !piece_is_free(grid->piece[grid_index(x, y)])) {
+        printf("    turn %d: target (%d, %d) is out of bounds or occupied: %s", turn, x, y, line);
+        return false;
+    }
+
+    // A spore flies straight from a SPORER along its facing, over free cells only
+    if (spore) {
+        // dir_from_char() reads anything else as N, so the facing is checked first
+        if (strcmp(parent->type, "SPORER") != 0 || parent->organ_dir[1] != '\0'
+            || memchr(dir_chars, parent->organ_dir[0], sizeof(dir_chars)) == NULL) {
+            printf("    turn %d: SPORE from organ %d, which is not a sporer: %s", turn, parent_id, line);
+            return false;
+        }
+        int from = grid_index(parent->x, parent->y), d = dir_from_char(parent->organ_dir[0]);
+        int cell = grid_nb[from][d];
+        while (cell != grid_index(x, y) && piece_is_free(grid->piece[cell])) {
+            cell = grid_nb[cell][d];
+        }
+        if (cell != grid_index(x, y)) {
+            printf("    turn %d: target (%d, %d) is not on the ray of sporer %d: %s", turn, x, y, parent_id, line);
+            return false;
+        }
+        return true;
+    }
+
+    // The organ grows along a shortest path of free cells toward the target
+    static int16_t dist[GRID_CELLS];
+    int source = grid_index(parent->x, parent->y);
+    grid_bfs(grid, &source, 1, dist);
+    if (dist[grid_index(x, y)] < 0) {
+        printf("    turn %d: target (%d, %d) is not reachable from organ %d: %s", turn, x, y, parent_id, line);
+        return false;
+    }
+    return true;
+}
+
+/* ################################################################################# */
+
+/* #############  CASES ###################################################### */
+
+// Function to split a case file into its directives and the input stream that follows
+static char *load_case(const char *filename, ReplayCase *rc, size_t *input_size) {
+    FILE *file = fopen(filename, "r");
+    if (file == NULL) {
+        perror(filename);
+        return NULL;
+    }
+
+    char *input = NULL;
+    FILE *stream = open_memstream(&input, input_size);
+    char line[512];
+    bool header = true;
+    memset(rc, 0, sizeof(*rc));
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (header && line[0] == '#') {
+            continue;
+        }
+        if (header && line[0] == '@') {
+            int turn, skip = 0;
+            if (sscanf(line, "@max_ms %lf", &rc->max_ms) == 1 || sscanf(line, "@max_nodes %ld", &rc->max_nodes) == 1) {
+                continue;
+            }
+            if (sscanf(line, "@expect %d %n", &turn, &skip) == 1 && skip > 0 && rc->expect_count < REPLAY_MAX_EXPECT) {
+                rc->expect_turn[rc->expect_count] = turn;
+                snprintf(rc->expect[rc->expect_count++], sizeof(rc->expect[0]), "%s", line + skip);
+                continue;
+            }
+            fprintf(stderr, "%s: unknown directive %s", filename, line);
+            continue;
+        }
+        header = false;
+        fputs(line, stream);
+    }
+    fclose(stream);
+    fclose(file);
+    return input;
+}
+
+// Function to replay one case with a strategy; returns the number of failures
+static int run_case(const char *filename, const Strategy *strategy) {
+    static GameState gameState;
+    static Grid grid;
+    ReplayCase rc;
+    size_t input_size;
+    int failures = 0;
+
+    char *input = load_case(filename, &rc, &input_size);
+    if (input == NULL) {
+        return 1;
+    }
+    FILE *in = fmemopen(input, input_size, "r");
+    if (in == NULL || !read_grid_size(in, &gameState)) {
+        printf("FAIL %s: no grid size line\n", filename);
+        free(input);
+        return 1;
+    }
+
+    // The corpus directives only hold for the default strategy
+    bool directives = strategy == strategies[0];
+    if (!directives) {
+        rc.max_ms = 0;
+        rc.max_nodes = 0;
+        rc.expect_count = 0;
+    }
+    if (strategy->begin != NULL && !strategy->begin()) {
+        printf("FAIL %s [%s]: strategy setup failed\n", filename, strategy->name);
+        fclose(in);
+        free(input);
+        return 1;
+    }
+
+    int turn = 0;
+    double worst_ms = 0;
+    long worst_nodes = 0;
+    char output[REPLAY_MAX_OUTPUT], first_action[128] = "";
+    for (; read_turn(in, &gameState); turn++) {
+        double best_ms = 1e9;
+        long nodes = 0;
+        for (int run = 0; run < (strategy->anytime ? 1 : REPLAY_RUNS); run++) {
+            memset(output, 0, sizeof(output));
+            FILE *capture = fmemopen(output, sizeof(output) - 1, "w");
+            action_stream = capture;
+            uint64_t nodes_before = search_stats.nodes_expanded;
+            double start = now_ms();
+            strategy->decide(&gameState, turn);
+            double elapsed = now_ms() - start;
+            nodes = (long)(search_stats.nodes_expanded - nodes_before);
+            action_stream = NULL;
+            fclose(capture);
+            best_ms = elapsed < best_ms ? elapsed : best_ms;
+        }
+        worst_ms = best_ms > worst_ms ? best_ms : worst_ms;
+        worst_nodes = nodes > worst_nodes ? nodes : worst_nodes;
+
+        if (rc.max_ms > 0 && best_ms > rc.max_ms) {
+            printf("    turn %d: %.3f ms over the %.3f ms budget\n", turn, best_ms, rc.max_ms);
+            failures++;
+        }
+        if (rc.max_nodes > 0 && nodes > rc.max_nodes) {
+            printf("    turn %d: %ld nodes over the %ld node budget\n", turn, nodes, rc.max_nodes);
+            failures++;
+        }
+
+        // Every line must be legal and there must be exactly one per organism
+        grid_from_state(&grid, &gameState);
+        int used_roots[MAX_ENTITIES], used_count = 0, lines = 0;
+        char *save;
+        for (char *line = strtok_r(output, "\n", &save); line != NULL; line = strtok_r(NULL, "\n", &save)) {
+            char action[128];
+            snprintf(action, sizeof(action), "%s\n", line);
+            if (turn == 0 && lines == 0) {
+                snprintf(first_action, sizeof(first_action), "%s", line);
+            }
+            if (!check_action(&gameState, &grid, turn, action, used_roots, &used_count)) {
+                failures++;
+            }
+            // The @expect lines of a turn apply to its action lines in order
+            int seen = 0;
+            for (int e = 0; e < rc.expect_count; e++) {
+                if (rc.expect_turn[e] != turn || seen++ != lines) {
+                    continue;
+                }
+                if (!action_matches(action, rc.expect[e])) {
+                    printf("    turn %d line %d: got %s, expected %s", turn, lines, line, rc.expect[e]);
+                    failures++;
+                }
+            }
+            lines++;
+        }
+        if (lines != gameState.required_actions_count) {
+            printf("    turn %d: %d action lines for %d organisms\n", turn, lines, gameState.required_actions_count);
+            failures++;
+        }
+        for (int e = 0, seen = 0; e < rc.expect_count; e++) {
+            if (rc.expect_turn[e] == turn && seen++ >= lines) {
+                printf("    turn %d: missing expected %s", turn, rc.expect[e]);
+                failures++;
+            }
+        }
+    }
+    fclose(in);
+    free(input);
+
+    if (turn == 0) {
+        printf("    no turns in the case\n");
+        failures++;
+    }
+    printf("%s %s [%s]: %d turns, worst %.3f ms, %ld nodes", failures ? "FAIL" : "ok  ", filename, strategy->name, turn,
+           worst_ms, worst_nodes);
+    printf(directives ? "\n" : ", first %s\n", first_action);
+    return failures;
+}
+
+/* ################################################################################# */
+
+int main(int argc, char **argv) {
+    bool verbose = false;
+    int cases = 0, failed = 0;
+    const char *selected = strategies[0]->name;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) {
+            verbose = true;
+        } else if (strcmp(argv[i], "--strategy") == 0 && i + 1 < argc) {
+            selected = argv[++i];
+        }
+    }
+    bool all = strcmp(selected, "all") == 0;
+    if (!all && strategy_find(selected) == NULL) {
+        printf("unknown strategy '%s', known strategies:\n", selected);
+        strategy_list(stdout);
+        return 2;
+    }
+    if (!verbose && freopen("/dev/null", "w", stderr) == NULL) {
+        perror("/dev/null");
+    }
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) {
+            continue;
+        }
+        if (strcmp(argv[i], "--strategy") == 0) {
+            i++;
+            continue;
+        }
+        for (int s = 0; s < STRATEGY_COUNT; s++) {
+            if (!all && strcmp(strategies[s]->name, selected) != 0) {
+                continue;
+            }
+            cases++;
+            perf_reset();
+            failed += run_case(argv[i], strategies[s]) > 0;
+            perf_report(stdout);
+        }
+    }
+    if (cases == 0) {
+        printf("usage: %s [-v] [--strategy NAME|all] case.txt...\n", argv[0]);
+        return 2;
+    }
+    printf("%d/%d cases passed\n", cases - failed, cases);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,81 @@
+#include "boss1Core.h"
+#include "boss1Map.h"
+
+// Scenario compiler: turns a hand-drawn ASCII map (legend in boss1Map.h) into the
+// exact stdin stream the bots read, so test and benchmark maps can be drawn instead
+// of copied from server output.
+//
+//   gcc -O2 -o boss1Scenario boss1Scenario.c
+//   ./boss1Scenario map.txt | ./boss1DecidePathToA
+//   ./boss1Scenario -m 10,2,2,2 -e 5,5,5,5 -s -n 3 map.txt > case.txt
+//
+//   -m A,B,C,D   our protein stock (default map_start_stock, 10,0,1,1)
+//   -e A,B,C,D   the opponent's stock (default: same as ours)
+//   -s           swap owners: the upper-case organs become the opponent's
+//   -n TURNS     repeat the turn block (default 1)
+
+static bool parse_stock(const char *text, int stock[4]) {
+    return sscanf(text, "%d,%d,%d,%d", &stock[0], &stock[1], &stock[2], &stock[3]) == 4;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [-m A,B,C,D] [-e A,B,C,D] [-s] [-n turns] map.txt\n", name);
+}
+
+int main(int argc, char **argv) {
+    static GameState gameState;
+    int my_stock[4], opp_stock[4];
+    bool my_set = false, opp_set = false, swap = false;
+    int turns = 1;
+    const char *filename = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-m") == 0 && i + 1 < argc && parse_stock(argv[i + 1], my_stock)) {
+            my_set = true;
+            i++;
+        } else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc && parse_stock(argv[i + 1], opp_stock)) {
+            opp_set = true;
+            i++;
+        } else if (strcmp(argv[i], "-s") == 0) {
+            swap = true;
+        } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            turns = atoi(argv[++i]);
+        } else if (argv[i][0] != '-' && filename == NULL) {
+            filename = argv[i];
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (filename == NULL) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (!map_load_ascii(filename, &gameState)) {
+        return 1;
+    }
+
+    if (swap) {
+        gameState.required_actions_count = 0;
+        for (int i = 0; i < gameState.entity_count; i++) {
+            Entity *e = &gameState.entities[i];
+            if (e->owner != -1) {
+                e->owner = e->owner == ME ? OPP : ME;
+                gameState.required_actions_count += e->owner == ME && strcmp(e->type, "ROOT") == 0;
+            }
+        }
+    }
+    if (my_set) {
+        memcpy(gameState.my_proteins, my_stock, sizeof(my_stock));
+        memcpy(gameState.opp_proteins, my_stock, sizeof(my_stock));
+    }
+    if (opp_set) {
+        memcpy(gameState.opp_proteins, opp_stock, sizeof(opp_stock));
+    }
+
+    write_grid_size(stdout, &gameState);
+    for (int t = 0; t < turns; t++) {
+        write_turn(stdout, &gameState);
+    }
+    return 0;
+}
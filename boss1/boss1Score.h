@@ -0,0 +1,225 @@
+#ifndef BOSS1_SCORE_H
+#define BOSS1_SCORE_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+#include "boss1DistField.h"
+#include "boss1Threat.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SCORE_X86 1
+#endif
+
+// Candidate-cell scoring as a weighted sum of grid layers. Each layer is a contiguous
+// int16 array over the bordered grid, so all cells are scored in one branch-free pass
+// (16 cells per AVX2 step, 8 per SSE2 step, scalar elsewhere) and a top-k pass picks
+// the candidates. The layers are rebuilt once per turn; the weights can change between
+// evaluations, which is what makes many evaluations per turn cheap.
+//
+// score[c] = candidate[c] ? sum(weight[l] * layer[l][c]) : SCORE_NONE, with saturating
+// adds. Layer values stay within +-255 and weights within +-127 so no product wraps;
+// a candidate whose sum saturates all the way down to SCORE_NONE is dropped.
+
+enum {
+    SCORE_LAYER_OPEN,                 // free neighbors: room to keep growing from the cell
+    SCORE_LAYER_TERRITORY,            // opponent's steps minus ours, clamped to +-16
+    SCORE_LAYER_PROTEIN,              // -steps to the nearest protein of any type
+    SCORE_LAYER_THREAT,               // -1 for each enemy tentacle facing the cell, now or after one enemy GROW
+    SCORE_LAYERS
+};
+
+#define SCORE_CELLS ((GRID_CELLS + 15) & ~15)   // padded to whole AVX2 vectors
+#define SCORE_NONE INT16_MIN
+#define SCORE_MAX_TOP 32
+
+typedef struct {
+    int16_t layer[SCORE_LAYERS][SCORE_CELLS] __attribute__((aligned(32)));
+    int16_t candidate[SCORE_CELLS] __attribute__((aligned(32)));  // 0xFFFF where a GROW may land, else 0
+    int16_t score[SCORE_CELLS] __attribute__((aligned(32)));
+} ScoreBoard;
+
+typedef struct {
+    int16_t cell;
+    int16_t score;
+} ScoredCell;
+
+/* #############  LAYERS ##################################################### */
+
+static inline int16_t score_clamp(int v, int limit) { return (int16_t)(v < -limit ? -limit : v > limit ? limit : v); }
+
+// Function to fill the layers for owner from the turn's grid and distance field; threats
+// tracks the tentacles of owner's opponent
+void score_build(ScoreBoard *b, const Grid *g, const DistField *field, int owner, const ThreatMap *threats) {
+    static int16_t dist[2][GRID_CELLS];
+    static int sources[GRID_CELLS];
+
+    memset(b, 0, sizeof(*b));
+    for (int side = 0; side < 2; side++) {
+        int count = 0;
+        for (int idx = 0; idx < GRID_CELLS; idx++) {
+            if (piece_is_organ(g->piece[idx]) && piece_owner(g->piece[idx]) == (side ? owner : !owner)) {
+                sources[count++] = idx;
+            }
+        }
+        grid_bfs(g, sources, count, dist[side]);
+    }
+
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        int piece = g->piece[idx];
+        if (!piece_is_free(piece)) {
+            continue;
+        }
+        int mine = dist[1][idx], theirs = dist[0][idx];
+        int nearest = DIST_UNREACHED;
+        for (int t = 0; t < 4; t++) {
+            nearest = field->dist[t][idx] < nearest ? field->dist[t][idx] : nearest;
+        }
+        b->candidate[idx] = mine == 1 ? -1 : 0;
+        int open = 0;
+        for (int d = 0; d < 4; d++) {
+            open += piece_is_free(g->piece[grid_nb[idx][d]]);
+        }
+        b->layer[SCORE_LAYER_OPEN][idx] = (int16_t)open;
+        b->layer[SCORE_LAYER_TERRITORY][idx] = score_clamp((theirs < 0 ? 255 : theirs) - (mine < 0 ? 255 : mine), 16);
+        b->layer[SCORE_LAYER_PROTEIN][idx] = (int16_t)-nearest;
+        b->layer[SCORE_LAYER_THREAT][idx] = (int16_t)-(threat_now(threats, idx) + threat_next(threats, idx));
+    }
+}
+
+/* ################################################################################# */
+
+/* #############  KERNELS #################################################### */
+
+// Reference kernel, one cell at a time
+void score_eval_scalar(ScoreBoard *b, const int16_t weight[SCORE_LAYERS]) {
+    for (int c = 0; c < SCORE_CELLS; c++) {
+        if (!b->candidate[c]) {
+            b->score[c] = SCORE_NONE;
+            continue;
+        }
+        int sum = 0;
+        for (int l = 0; l < SCORE_LAYERS; l++) { // saturate after every add, as the vector kernels do
+            sum += weight[l] * b->layer[l][c];
+            sum = sum < INT16_MIN ? INT16_MIN : sum > INT16_MAX ? INT16_MAX : sum;
+        }
+        b->score[c] = (int16_t)sum;
+    }
+}
+
+#ifdef SCORE_X86
+// SSE2 is part of x86-64, so this kernel needs no runtime check
+__attribute__((target("sse2"))) void score_eval_sse2(ScoreBoard *b, const int16_t weight[SCORE_LAYERS]) {
+    __m128i w[SCORE_LAYERS];
+    for (int l = 0; l < SCORE_LAYERS; l++) {
+        w[l] = _mm_set1_epi16(weight[l]);
+    }
+    const __m128i none = _mm_set1_epi16(SCORE_NONE);
+    for (int c = 0; c < SCORE_CELLS; c += 8) {
+        __m128i sum = _mm_setzero_si128();
+        for (int l = 0; l < SCORE_LAYERS; l++) {
+            __m128i v = _mm_load_si128((const __m128i *)&b->layer[l][c]);
+            sum = _mm_adds_epi16(sum, _mm_mullo_epi16(v, w[l]));
+        }
+        __m128i mask = _mm_load_si128((const __m128i *)&b->candidate[c]);
+        sum = _mm_or_si128(_mm_and_si128(mask, sum), _mm_andnot_si128(mask, none));
+        _mm_store_si128((__m128i *)&b->score[c], sum);
+    }
+}
+
+__attribute__((target("avx2"))) void score_eval_avx2(ScoreBoard *b, const int16_t weight[SCORE_LAYERS]) {
+    __m256i w[SCORE_LAYERS];
+    for (int l = 0; l < SCORE_LAYERS; l++) {
+        w[l] = _mm256_set1_epi16(weight[l]);
+    }
+    const __m256i none = _mm256_set1_epi16(SCORE_NONE);
+    for (int c = 0; c < SCORE_CELLS; c += 16) {
+        __m256i sum = _mm256_setzero_si256();
+        for (int l = 0; l < SCORE_LAYERS; l++) {
+            __m256i v = _mm256_load_si256((const __m256i *)&b->layer[l][c]);
+            sum = _mm256_adds_epi16(sum, _mm256_mullo_epi16(v, w[l]));
+        }
+        __m256i mask = _mm256_load_si256((const __m256i *)&b->candidate[c]);
+        sum = _mm256_blendv_epi8(none, sum, mask);
+        _mm256_store_si256((__m256i *)&b->score[c], sum);
+    }
+}
+#endif
+
+typedef void (*ScoreKernel)(ScoreBoard *b, const int16_t weight[SCORE_LAYERS]);
+
+// Function to pick the widest kernel this CPU runs; BOSS1_SCORE_SCALAR forces the reference
+ScoreKernel score_kernel(void) {
+    static ScoreKernel kernel;
+    if (kernel == NULL) {
+        kernel = score_eval_scalar;
+#ifdef SCORE_X86
+        if (getenv("BOSS1_SCORE_SCALAR") == NULL) {
+            __builtin_cpu_init();
+            kernel = __builtin_cpu_supports("avx2") ? score_eval_avx2 : score_eval_sse2;
+        }
+#endif
+    }
+    return kernel;
+}
+
+static inline void score_eval(ScoreBoard *b, const int16_t weight[SCORE_LAYERS]) { score_kernel()(b, weight); }
+
+/* ################################################################################# */
+
+/* #############  TOP-K ###################################################### */
+
+// Bitmask of the 8 cells from c on whose score beats threshold
+static inline unsigned score_above(const ScoreBoard *b, int c, int16_t threshold) {
+#ifdef SCORE_X86
+    __m128i v = _mm_load_si128((const __m128i *)&b->score[c]);
+    __m128i gt = _mm_packs_epi16(_mm_cmpgt_epi16(v, _mm_set1_epi16(threshold)), _mm_setzero_si128());
+    return (unsigned)_mm_movemask_epi8(gt);
+#else
+    unsigned bits = 0;
+    for (int i = 0; i < 8; i++) {
+        bits |= (unsigned)(b->score[c + i] > threshold) << i;
+    }
+    return bits;
+#endif
+}
+
+// Function to collect the k best-scoring candidates, best first; ties keep the lower
+// cell index. Returns the number found (fewer than k if there are fewer candidates).
+// Blocks of 8 cells with nothing above the current k-th score are skipped whole.
+int score_top_k(const ScoreBoard *b, int k, ScoredCell *out) {
+    int count = 0;
+    int16_t threshold = SCORE_NONE;
+    if (k <= 0) {
+        return 0;
+    }
+    k = k > SCORE_MAX_TOP ? SCORE_MAX_TOP : k;
+    for (int c = 0; c < SCORE_CELLS; c += 8) {
+        for (unsigned bits = score_above(b, c, threshold); bits; bits &= bits - 1) {
+            int cell = c + __builtin_ctz(bits);
+            int16_t s = b->score[cell];
+            if (s <= threshold) {
+                continue; // the threshold rose within this block
+            }
+            int i = count < k ? count++ : k - 1;
+            while (i > 0 && out[i - 1].score < s) { // insertion into the sorted prefix
+                out[i] = out[i - 1];
+                i--;
+            }
+            out[i] = (ScoredCell){(int16_t)cell, s};
+            if (count == k) {
+                threshold = out[k - 1].score;
+            }
+        }
+    }
+    return count;
+}
+
+/* ################################################################################# */
+
+#endif
@@ -0,0 +1,280 @@
+#ifndef BOSS1_SIM_H
+#define BOSS1_SIM_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+#include "boss1Zobrist.h"
+#include "boss1Frontier.h"
+
+// Forward simulator for GROW sequences. The state is a core Grid plus both protein
+// stocks, and every mutation goes through sim_set_piece()/sim_set_stock() so the
+// Zobrist hash and both growth frontiers are updated incrementally instead of being
+// recomputed.
+
+#define SIM_MAX_MOVES 512
+
+typedef struct {
+    Grid grid;
+    int proteins[2][4];               // indexed by owner (ME / OPP), then A..D
+    int organ_count[2];
+    int next_organ_id;
+    int side;                         // owner to move in a sequential search
+    int turn;
+    uint64_t hash;
+    Frontier frontier[2];             // free cells next to each owner's organs
+} SimState;
+
+/* #############  STATE UPDATES ############################################## */
+
+// Function to change the piece on a cell, keeping the hash, organ counts and frontiers
+// in step
+void sim_set_piece(SimState *s, int idx, int piece, int organ_id) {
+    int old = s->grid.piece[idx];
+    if (piece_is_organ(old)) {
+        s->organ_count[piece_owner(old)]--;
+    }
+    if (piece_is_organ(piece)) {
+        s->organ_count[piece_owner(piece)]++;
+    }
+    s->hash ^= zobrist.piece[idx][old] ^ zobrist.piece[idx][piece];
+    s->grid.piece[idx] = (uint8_t)piece;
+    s->grid.organ_id[idx] = (int16_t)organ_id;
+    frontier_update(s->frontier, &s->grid, idx, old);
+}
+
+// Function to set a protein stock, swapping its hash term
+void sim_set_stock(SimState *s, int owner, int type, int stock) {
+    s->hash ^= zobrist_protein_key(owner, type, s->proteins[owner][type]);
+    s->hash ^= zobrist_protein_key(owner, type, stock);
+    s->proteins[owner][type] = stock;
+}
+
+void sim_toggle_side(SimState *s) {
+    s->side ^= 1;
+    s->hash ^= zobrist.side;
+}
+
+// Function to load the parsed turn and hash it from scratch; call zobrist_init() once before this
+void sim_load(SimState *s, const GameState *gameState) {
+    memset(s, 0, sizeof(*s));
+    grid_from_state(&s->grid, gameState);
+    s->side = ME;
+    s->next_organ_id = 1;
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        int piece = s->grid.piece[idx];
+        s->hash ^= zobrist.piece[idx][piece];
+        if (piece_is_organ(piece)) {
+            s->organ_count[piece_owner(piece)]++;
+            if (s->grid.organ_id[idx] >= s->next_organ_id) {
+                s->next_organ_id = s->grid.organ_id[idx] + 1;
+            }
+        }
+    }
+    for (int t = 0; t < 4; t++) {
+        s->proteins[ME][t] = gameState->my_proteins[t];
+        s->proteins[OPP][t] = gameState->opp_proteins[t];
+        s->hash ^= zobrist_protein_key(ME, t, s->proteins[ME][t]);
+        s->hash ^= zobrist_protein_key(OPP, t, s->proteins[OPP][t]);
+    }
+    frontier_build(s->frontier, &s->grid);
+}
+
+// Function to write the state as the referee would send it to owner, the inverse of
+// sim_load() up to the organ trees: parents are rebuilt by a BFS over each root's
+// organs, since the simulator does not keep them
+void sim_to_game_state(const SimState *s, int owner, GameState *gameState) {
+    static int16_t parent[GRID_CELLS], root[GRID_CELLS];
+    static int queue[GRID_CELLS];
+    const Grid *g = &s->grid;
+    int front = 0, rear = 0;
+
+    gameState->width = g->width;
+    gameState->height = g->height;
+    gameState->entity_count = 0;
+    gameState->required_actions_count = 0;
+    memset(root, 0, sizeof(root));
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        int piece = g->piece[idx];
+        if (piece_is_organ(piece) && piece_organ_type(piece) == ORGAN_ROOT) {
+            parent[idx] = 0;
+            root[idx] = g->organ_id[idx];
+            queue[rear++] = idx;
+            gameState->required_actions_count += piece_owner(piece) == owner;
+        }
+    }
+    while (front < rear) {
+        int c = queue[front++];
+        for (int d = 0; d < 4; d++) {
+            int nb = grid_nb[c][d];
+            if (piece_is_organ(g->piece[nb]) && root[nb] == 0 && piece_organ_type(g->piece[nb]) != ORGAN_ROOT &&
+                piece_owner(g->piece[nb]) == piece_owner(g->piece[c])) {
+                parent[nb] = g->organ_id[c];
+                root[nb] = root[c];
+                queue[rear++] = nb;
+            }
+        }
+    }
+
+    for (int y = 0; y < g->height; y++) {
+        for (int x = 0; x < g->width; x++) {
+            int idx = grid_index(x, y), piece = g->piece[idx];
+            if (piece == PIECE_EMPTY) {
+                continue;
+            }
+            Entity *e = &gameState->entities[gameState->entity_count++];
+            *e = (Entity){x, y, "WALL", -1, 0, "X", 0, 0};
+            if (piece_is_protein(piece)) {
+                e->type[0] = (char)('A' + piece - PIECE_PROTEIN);
+                e->type[1] = '\0';
+            } else if (piece_is_organ(piece)) {
+                strcpy(e->type, organ_names[piece_organ_type(piece)]);
+                e->owner = piece_owner(piece) == owner ? ME : OPP;
+                e->organ_id = g->organ_id[idx];
+                e->organ_dir[0] = dir_chars[piece_dir(piece)];
+                e->organ_parent_id = parent[idx];
+                e->organ_root_id = root[idx];
+            }
+        }
+    }
+    for (int t = 0; t < 4; t++) {
+        gameState->my_proteins[t] = s->proteins[owner][t];
+        gameState->opp_proteins[t] = s->proteins[!owner][t];
+    }
+}
+
+/* ################################################################################# */
+
+/* #############  MOVES ###################################################### */
+
+// Moves pack into 24 bits: parent cell, target cell, organ type, direction, valid flag.
+// 0 is WAIT, which also makes it the "no move" value in the transposition table.
+#define MOVE_WAIT 0u
+
+_Static_assert(GRID_CELLS <= 512, "a move packs each cell index into 9 bits");
+
+static inline uint32_t move_encode(int from, int to, int type, int dir) {
+    return (uint32_t)from | ((uint32_t)to << 9) | ((uint32_t)type << 18) | ((uint32_t)dir << 21) | (1u << 23);
+}
+static inline int move_from(uint32_t m) { return m & 511; }
+static inline int move_to(uint32_t m) { return (m >> 9) & 511; }
+static inline int move_type(uint32_t m) { return (m >> 18) & 7; }
+static inline int move_dir(uint32_t m) { return (m >> 21) & 3; }
+
+bool sim_can_afford(const SimState *s, int owner, int type) {
+    for (int t = 0; t < 4; t++) {
+        if (s->proteins[owner][t] < organ_cost[type][t]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Function to list the GROW moves of one owner: BASIC onto every cell of its frontier,
+// and HARVESTER facing an adjacent protein when affordable. Each target/type/dir is
+// listed once, from the parent frontier_parent() finds. Returns the number of moves
+// written.
+int sim_gen_grows(const SimState *s, int owner, uint32_t *moves, int max_moves) {
+    const Grid *g = &s->grid;
+    const Frontier *fr = &s->frontier[owner];
+    int count = 0;
+    bool basic = sim_can_afford(s, owner, ORGAN_BASIC);
+    bool harvester = sim_can_afford(s, owner, ORGAN_HARVESTER);
+
+    if (!basic && !harvester) {
+        return 0;
+    }
+    for (int i = 0; i < fr->count; i++) {
+        int to = fr->cell[i];
+        int from = frontier_parent(g, owner, to);
+        if (basic && count < max_moves) {
+            moves[count++] = move_encode(from, to, ORGAN_BASIC, 0);
+        }
+        for (int f = 0; harvester && f < 4; f++) {
+            int faced = grid_neighbor(g, to, f);
+            if (piece_is_protein(g->piece[faced]) && count < max_moves) {
+                moves[count++] = move_encode(from, to, ORGAN_HARVESTER, f);
+            }
+        }
+    }
+    return count;
+}
+
+// Function to apply one GROW for owner: pay the cost, absorb a protein source under
+// the new organ (+3 of its type) and place the organ. Returns false if unaffordable.
+bool sim_apply_grow(SimState *s, int owner, uint32_t move) {
+    if (move == MOVE_WAIT) {
+        return true;
+    }
+    int type = move_type(move);
+    int to = move_to(move);
+    if (!sim_can_afford(s, owner, type) || !piece_is_free(s->grid.piece[to])) {
+        return false;
+    }
+    for (int t = 0; t < 4; t++) {
+        if (organ_cost[type][t]) {
+            sim_set_stock(s, owner, t, s->proteins[owner][t] - organ_cost[type][t]);
+        }
+    }
+    int piece = s->grid.piece[to];
+    if (piece_is_protein(piece)) {
+        int t = piece - PIECE_PROTEIN;
+        sim_set_stock(s, owner, t, s->proteins[owner][t] + 3);
+    }
+    sim_set_piece(s, to, organ_piece(owner, type, move_dir(move)), s->next_organ_id++);
+    return true;
+}
+
+// Function to play both players' moves of one simultaneous turn. Two GROWs onto the same
+// cell cancel each other and leave a wall there, as in the referee; nothing is paid.
+void sim_apply_joint(SimState *s, uint32_t my_move, uint32_t opp_move) {
+    if (my_move != MOVE_WAIT && opp_move != MOVE_WAIT && move_to(my_move) == move_to(opp_move)) {
+        sim_set_piece(s, move_to(my_move), PIECE_WALL, 0);
+        return;
+    }
+    sim_apply_grow(s, ME, my_move);
+    sim_apply_grow(s, OPP, opp_move);
+}
+
+// Function to finish a turn: every harvester facing a protein source yields one of it
+void sim_end_turn(SimState *s) {
+    const Grid *g = &s->grid;
+    int income[2][4] = {{0}};
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        int piece = g->piece[idx];
+        if (!piece_is_organ(piece) || piece_organ_type(piece) != ORGAN_HARVESTER) {
+            continue;
+        }
+        int faced = grid_neighbor(g, idx, piece_dir(piece));
+        if (piece_is_protein(g->piece[faced])) {
+            income[piece_owner(piece)][g->piece[faced] - PIECE_PROTEIN]++;
+        }
+    }
+    for (int o = 0; o < 2; o++) {
+        for (int t = 0; t < 4; t++) {
+            if (income[o][t]) {
+                sim_set_stock(s, o, t, s->proteins[o][t] + income[o][t]);
+            }
+        }
+    }
+    s->turn++;
+}
+
+// Function to print a move in the referee's output format
+void sim_print_move(const SimState *s, uint32_t move) {
+    if (move == MOVE_WAIT) {
+        emit_action("WAIT\n");
+        return;
+    }
+    int to = move_to(move);
+    emit_action("GROW %d %d %d %s %c\n", s->grid.organ_id[move_from(move)],
+                grid_x(to), grid_y(to), organ_names[move_type(move)], dir_chars[move_dir(move)]);
+}
+
+/* ################################################################################# */
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef BOSS1_STRATEGIES_H
+#define BOSS1_STRATEGIES_H
+
+// Registry of every bot strategy, for tools that pick or compare them in one process.
+// The bot files are included with BOSS1_NO_MAIN; boss1DecidePathToA.c comes first
+// because its map legend has to precede the core.
+
+#ifndef BOSS1_NO_MAIN
+#define BOSS1_NO_MAIN
+#endif
+#include "boss1DecidePathToA.c"
+#include "boss1Duct.c"
+#include "boss1Greedy.c"
+#include "test.c"
+
+// The first entry is the default, and the one the replay corpus expectations describe
+static const Strategy *const strategies[] = {
+    &strategy_path_to_a, &strategy_duct, &strategy_greedy, &strategy_test_step, &strategy_test_direct,
+};
+#define STRATEGY_COUNT ((int)(sizeof(strategies) / sizeof(strategies[0])))
+
+// Function to look a strategy up by name, NULL if there is none
+const Strategy *strategy_find(const char *name) {
+    for (int i = 0; i < STRATEGY_COUNT; i++) {
+        if (strcmp(strategies[i]->name, name) == 0) {
+            return strategies[i];
+        }
+    }
+    return NULL;
+}
+
+// Function to print the registry, one strategy per line
+void strategy_list(FILE *out) {
+    for (int i = 0; i < STRATEGY_COUNT; i++) {
+        fprintf(out, "  %-12s %s%s\n", strategies[i]->name, strategies[i]->summary, i == 0 ? " (default)" : "");
+    }
+}
+
+// Function to pick the strategy from --strategy NAME, else BOSS1_STRATEGY, else the
+// default; NULL (after listing the known names) for an unknown name
+const Strategy *strategy_select(int argc, char **argv) {
+    const char *name = getenv("BOSS1_STRATEGY");
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--strategy") == 0) {
+            name = argv[i + 1];
+        }
+    }
+    if (name == NULL || name[0] == '\0') {
+        return strategies[0];
+    }
+    const Strategy *strategy = strategy_find(name);
+    if (strategy == NULL) {
+        fprintf(stderr, "unknown strategy '%s', known strategies:\n", name);
+        strategy_list(stderr);
+    }
+    return strategy;
+}
+
+#endif
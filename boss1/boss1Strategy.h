@@ -0,0 +1,79 @@
+#ifndef BOSS1_STRATEGY_H
+#define BOSS1_STRATEGY_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <poll.h>
+
+#include "boss1Core.h"
+#include "boss1Log.h"
+#include "boss1Perf.h"
+
+// Common interface of the bots. A strategy only decides: the game loop that reads the
+// turns, logs them and flushes the actions is strategy_run(), shared by every bot's
+// main() and by boss1Bot, which picks a strategy from boss1Strategies.h at run time.
+//
+// A strategy with a ponder hook gets the time between turns: the loop calls it once
+// the actions are flushed, and it must return as soon as strategy_input_ready() says
+// the next turn has started to arrive. The referee only sends a turn after reading
+// our actions, so stdin's buffer is empty then and polling the descriptor suffices.
+
+typedef struct {
+    const char *name;
+    const char *summary;
+    bool anytime;                     // searches until its deadline: time one run, not the best of several
+    bool (*begin)(void);              // before each game's first turn; NULL if there is nothing to set up
+    void (*decide)(GameState *gameState, int turn); // exactly one action line per organism
+    void (*ponder)(void);             // until strategy_input_ready(); NULL if the strategy does not ponder
+} Strategy;
+
+// Function to check, without blocking, whether stdin has input (or has reached EOF)
+static inline bool strategy_input_ready(void) {
+    struct pollfd in = {0, POLLIN, 0};
+    return poll(&in, 1, 0) != 0;
+}
+
+// Function to play one game on stdin/stdout with a strategy
+int strategy_run(const Strategy *strategy) {
+    static GameState gameState;
+
+    game_log_start_from_env();
+    if (strategy->begin != NULL && !strategy->begin()) {
+        return 1;
+    }
+
+    // Read width and height
+    if (!read_grid_size(stdin, &gameState)) {
+        return 1;
+    }
+
+    // Game loop
+    for (int turn = 0; read_turn(stdin, &gameState); turn++) {
+        log_write_turn(&game_log, &gameState);
+
+        // Print the current state of the game map
+        print_map(&gameState);
+
+        strategy->decide(&gameState, turn);
+        fflush(stdout);
+        if (strategy->ponder != NULL) {
+            strategy->ponder();
+        }
+    }
+
+    perf_report(stderr);
+    log_close(&game_log);
+    return 0;
+}
+
+// Function to answer WAIT for the organisms a strategy left without an action
+static inline void strategy_wait_rest(const GameState *gameState, int printed) {
+    for (; printed < gameState->required_actions_count; printed++) {
+        emit_action("WAIT\n");
+    }
+}
+
+#endif
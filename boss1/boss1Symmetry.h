@@ -0,0 +1,97 @@
+#ifndef BOSS1_SYMMETRY_H
+#define BOSS1_SYMMETRY_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+
+// Symmetry of the static walls. Arena maps mirror one player's half onto the other's,
+// usually through the center point, so anything computed from the walls alone holds
+// for a cell's image under the transform once the direction is mapped too. Tables
+// built for the canonical cells (one per orbit, about half the map) then answer for
+// every cell: a query from the other half reads the canonical cell's entry and maps
+// the result back through image[]. The sporer rays (boss1Rays.h) are listed for the
+// canonical half only; the chokepoint analysis (boss1Choke.h) copies a component onto
+// its image when the two are distinct.
+//
+// symmetry_detect() tries the point reflection first, then the two mirrors, and falls
+// back to SYM_NONE, where every cell is canonical and image[] is the identity. Cells
+// off the map (and the border) are their own images.
+
+enum { SYM_NONE, SYM_POINT, SYM_MIRROR_X, SYM_MIRROR_Y, SYM_KINDS };
+
+static inline const char *sym_name(int kind) {
+    static const char *names[SYM_KINDS] = {"none", "point", "mirror-x", "mirror-y"};
+    return names[kind];
+}
+
+typedef struct {
+    int kind;
+    int16_t image[GRID_CELLS];        // cell -> its image; applying it twice is the identity
+    uint8_t dir_image[4];             // direction -> its image, N E S W order
+    Bitboard canonical;               // cells whose tables are built; the rest read their image's
+} Symmetry;
+
+static inline int sym_cell(const Symmetry *sym, int idx) { return sym->image[idx]; }
+static inline int sym_dir(const Symmetry *sym, int d) { return sym->dir_image[d]; }
+static inline bool sym_is_canonical(const Symmetry *sym, int idx) { return bb_test(&sym->canonical, idx); }
+
+/* #############  DETECTION ################################################## */
+
+// Function to map a cell of a width x height map through a transform of one kind
+static inline int sym_map(int kind, int width, int height, int x, int y) {
+    int mx = kind == SYM_POINT || kind == SYM_MIRROR_X ? width - 1 - x : x;
+    int my = kind == SYM_POINT || kind == SYM_MIRROR_Y ? height - 1 - y : y;
+    return grid_index(mx, my);
+}
+
+// Function to fill the transform of one kind for a width x height map
+void sym_fill(Symmetry *sym, int kind, int width, int height) {
+    static const uint8_t dirs[SYM_KINDS][4] = {{0, 1, 2, 3}, {2, 3, 0, 1}, {0, 3, 2, 1}, {2, 1, 0, 3}};
+    sym->kind = kind;
+    memcpy(sym->dir_image, dirs[kind], sizeof(sym->dir_image));
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        sym->image[idx] = (int16_t)idx;
+    }
+    memset(&sym->canonical, 0xFF, sizeof(sym->canonical)); // cells off the map are their own images
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            int idx = grid_index(x, y), image = sym_map(kind, width, height, x, y);
+            sym->image[idx] = (int16_t)image;
+            if (idx > image) {
+                bb_reset(&sym->canonical, idx);
+            }
+        }
+    }
+}
+
+// Function to find a transform that maps the walls of the grid onto themselves; the
+// walls are compared first, each pair of cells once, so only the transform kept fills
+// the tables
+int symmetry_detect(Symmetry *sym, const Grid *grid) {
+    int kind = SYM_POINT;
+    for (; kind < SYM_KINDS; kind++) {
+        bool holds = true;
+        int rows = kind == SYM_MIRROR_X ? grid->height : (grid->height + 1) / 2;
+        int cols = kind == SYM_MIRROR_X ? (grid->width + 1) / 2 : grid->width;
+        for (int y = 0; y < rows && holds; y++) {
+            for (int x = 0; x < cols && holds; x++) {
+                int image = sym_map(kind, grid->width, grid->height, x, y);
+                holds = (grid->piece[grid_index(x, y)] == PIECE_WALL) == (grid->piece[image] == PIECE_WALL);
+            }
+        }
+        if (holds) {
+            break;
+        }
+    }
+    sym_fill(sym, kind < SYM_KINDS ? kind : SYM_NONE, grid->width, grid->height);
+    return sym->kind;
+}
+
+/* ################################################################################# */
+
+#endif
@@ -0,0 +1,201 @@
+#ifndef BOSS1_THREAT_H
+#define BOSS1_THREAT_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+
+// Enemy tentacle threat per cell, kept up to date from the cells that change:
+//
+//   now[c]   enemy tentacles facing c: an organ of ours there is attacked
+//   next[c]  free cells next to c where the enemy could grow a tentacle facing c
+//            (cells adjacent to an enemy organ), i.e. attacks one enemy GROW away
+//
+// A cell change only affects the tentacle it adds or removes and whether the cell and
+// its four neighbors can be grown into, so an update touches a radius of two cells.
+// A search that knows the cells its moves change feeds them to threat_set_cell();
+// threat_sync() follows a turn's input from its entity list, since a cell can only
+// change by gaining or losing an organ, or by becoming a wall where two GROWs met;
+// threat_sync_grid() follows a simulator position, whose changes are not listed.
+
+typedef struct {
+    uint8_t piece[GRID_CELLS];        // the grid as last seen
+    uint8_t now[GRID_CELLS];
+    uint8_t next[GRID_CELLS];
+    Bitboard growable;                // free cells adjacent to an enemy organ
+    Bitboard organs;                  // cells holding an organ of either owner, as last seen
+    int enemy;                        // owner whose tentacles are tracked
+    bool armed;                       // the enemy can afford a TENTACLE
+} ThreatMap;
+
+static inline bool threat_is_enemy_organ(const ThreatMap *tm, int piece) {
+    return piece_is_organ(piece) && piece_owner(piece) == tm->enemy;
+}
+
+// Function to add (sign 1) or remove (sign -1) the attack of a piece on its front cell
+static inline void threat_tentacle(ThreatMap *tm, int idx, int piece, int sign) {
+    if (threat_is_enemy_organ(tm, piece) && piece_organ_type(piece) == ORGAN_TENTACLE) {
+        tm->now[grid_nb[idx][piece_dir(piece)]] += sign;
+    }
+}
+
+// Function to recheck whether the enemy could grow into a cell and move its
+// contribution to the neighbors' next counts when that changes
+static void threat_refresh_growable(ThreatMap *tm, int idx) {
+    bool growable = false;
+    if (piece_is_free(tm->piece[idx])) {
+        for (int d = 0; d < 4 && !growable; d++) {
+            growable = threat_is_enemy_organ(tm, tm->piece[grid_nb[idx][d]]);
+        }
+    }
+    if (growable == bb_test(&tm->growable, idx)) {
+        return;
+    }
+    int sign = growable ? 1 : -1;
+    if (growable) {
+        bb_set(&tm->growable, idx);
+    } else {
+        bb_reset(&tm->growable, idx);
+    }
+    for (int d = 0; d < 4; d++) {
+        tm->next[grid_nb[idx][d]] += sign;
+    }
+}
+
+// Function to record a new piece on one cell
+void threat_set_cell(ThreatMap *tm, int idx, int piece) {
+    int old = tm->piece[idx];
+    if (old == piece) {
+        return;
+    }
+    threat_tentacle(tm, idx, old, -1);
+    tm->piece[idx] = (uint8_t)piece;
+    threat_tentacle(tm, idx, piece, 1);
+    if (piece_is_organ(piece)) {
+        bb_set(&tm->organs, idx);
+    } else {
+        bb_reset(&tm->organs, idx);
+    }
+    threat_refresh_growable(tm, idx);
+    for (int d = 0; d < 4; d++) {
+        threat_refresh_growable(tm, grid_nb[idx][d]);
+    }
+}
+
+// Function to start tracking the organs of enemy from an all-wall grid
+void threat_init(ThreatMap *tm, const Grid *grid, int enemy) {
+    memset(tm, 0, sizeof(*tm));
+    memset(tm->piece, PIECE_WALL, sizeof(tm->piece));
+    tm->enemy = enemy;
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        threat_set_cell(tm, idx, grid->piece[idx]);
+    }
+}
+
+// Function to note whether the enemy, with stock A..D, can afford a TENTACLE; without
+// one the next-turn threat is not real
+static void threat_arm(ThreatMap *tm, const int enemy_stock[4]) {
+    tm->armed = true;
+    for (int t = 0; t < 4; t++) {
+        tm->armed &= enemy_stock[t] >= organ_cost[ORGAN_TENTACLE][t];
+    }
+}
+
+// Function to bring the map in line with this turn's input, grid being built from it:
+// the cells of its entities and the organs seen last time are the only ones visited.
+// enemy_stock is the enemy's A..D, which decides whether the next-turn threat is real
+void threat_sync(ThreatMap *tm, const Grid *grid, const GameState *gameState, const int enemy_stock[4]) {
+    Bitboard lost = tm->organs;
+    for (int i = 0; i < gameState->entity_count; i++) {
+        int idx = grid_index(gameState->entities[i].x, gameState->entities[i].y);
+        threat_set_cell(tm, idx, grid->piece[idx]);
+        bb_reset(&lost, idx);
+    }
+    BB_FOREACH(&lost, idx) { // organs that died; their cells are empty now
+        threat_set_cell(tm, idx, grid->piece[idx]);
+    }
+    threat_arm(tm, enemy_stock);
+}
+
+// Function to bring the map in line with a grid whose changed cells are not known:
+// the pieces are compared with the ones last seen eight at a time, and only the cells
+// that differ are updated
+void threat_sync_grid(ThreatMap *tm, const Grid *grid, const int enemy_stock[4]) {
+    for (int base = 0; base < GRID_CELLS; base += 8) {
+        uint64_t seen, piece;
+        if (base + 8 <= GRID_CELLS) {
+            memcpy(&seen, &tm->piece[base], sizeof(seen));
+            memcpy(&piece, &grid->piece[base], sizeof(piece));
+            if (seen == piece) {
+                continue;
+            }
+        }
+        for (int idx = base; idx < base + 8 && idx < GRID_CELLS; idx++) {
+            threat_set_cell(tm, idx, grid->piece[idx]);
+        }
+    }
+    threat_arm(tm, enemy_stock);
+}
+
+/* #############  QUERIES #################################################### */
+
+static inline int threat_now(const ThreatMap *tm, int idx) { return tm->now[idx]; }
+static inline int threat_next(const ThreatMap *tm, int idx) { return tm->armed ? tm->next[idx] : 0; }
+
+// A cell we should not grow into: attacked now, or one enemy GROW away from it
+static inline bool threat_is_dangerous(const ThreatMap *tm, int idx) {
+    return threat_now(tm, idx) > 0 || threat_next(tm, idx) > 0;
+}
+
+// Function to list the enemy tentacles attacking a cell now; returns the count
+int threat_attackers(const ThreatMap *tm, int idx, int out[4]) {
+    int count = 0;
+    for (int d = 0; d < 4; d++) {
+        int nb = grid_nb[idx][d];
+        int piece = tm->piece[nb];
+        if (threat_is_enemy_organ(tm, piece) && piece_organ_type(piece) == ORGAN_TENTACLE &&
+            grid_nb[nb][piece_dir(piece)] == idx) {
+            out[count++] = nb;
+        }
+    }
+    return count;
+}
+
+// Function to list the enemy organs that could attack a cell after one GROW: for each
+// growable neighbor, the enemy organs next to it (the GROW's possible parents).
+// Returns the count; a parent reaching the cell through two growable cells is listed twice.
+int threat_next_attackers(const ThreatMap *tm, int idx, int out[16]) {
+    int count = 0;
+    for (int d = 0; d < 4; d++) {
+        int g = grid_nb[idx][d];
+        if (!bb_test(&tm->growable, g)) {
+            continue;
+        }
+        for (int e = 0; e < 4; e++) {
+            int parent = grid_nb[g][e];
+            if (threat_is_enemy_organ(tm, tm->piece[parent])) {
+                out[count++] = parent;
+            }
+        }
+    }
+    return count;
+}
+
+// Function to print our organs under attack, now and after one enemy GROW
+void threat_print(const ThreatMap *tm, FILE *out) {
+    for (int idx = 0; idx < GRID_CELLS; idx++) {
+        int piece = tm->piece[idx];
+        if (piece_is_organ(piece) && piece_owner(piece) != tm->enemy && (tm->now[idx] || threat_next(tm, idx))) {
+            fprintf(out, "threat (%d, %d): %d tentacles now, %d next turn\n", grid_x(idx), grid_y(idx),
+                    tm->now[idx], threat_next(tm, idx));
+        }
+    }
+}
+
+/* ################################################################################# */
+
+#endif
@@ -0,0 +1,282 @@
+#include <unistd.h>
+#include <math.h>
+#include <sys/wait.h>
+
+#include "boss1Strategies.h"
+#include "boss1Sim.h"
+#include "boss1Map.h"
+
+// SPSA tuner for a strategy's parameters, by local self-play.
+//
+//   gcc -O2 -o boss1Tuner boss1Tuner.c -lm
+//   ./boss1Tuner [-s strategy] [-i iterations] [-g games] [-j workers] [-o boss1ParamsTuned.h] [maps...]
+//
+// The strategy is the default one (pathToA, the shipped bot) unless -s names greedy;
+// only the parameters that strategy reads are moved. Every iteration perturbs them all
+// at once by +-c_k (in units of each parameter's range), plays theta+ against theta-
+// on the same maps from both seats, and moves theta along the estimated gradient.
+// Games run in the simulator, in forked workers, one result per game back through a
+// pipe. Maps are ASCII drawings with 'R' and 'r' roots; without any, point-symmetric
+// random maps are generated. The final vector is played against the defaults and
+// written as boss1ParamsTuned.h, which boss1Params.h picks up.
+
+#define TUNER_LAST_TURN 100
+#define TUNER_MAX_MAPS 64
+#define TUNER_MAX_WORKERS 64
+
+typedef struct {
+    SimState start[TUNER_MAX_MAPS];
+    int count;
+} MapSet;
+
+static uint64_t tuner_rng = 0x2545F4914F6CDD1DULL;
+
+// Function to generate a fresh start position into a simulator state
+static void random_map(SimState *s) {
+    static GameState gameState;
+    map_random(&gameState, &tuner_rng);
+    sim_load(s, &gameState);
+}
+
+/* #############  PLAYERS #################################################### */
+
+typedef uint32_t (*TunerMove)(const SimState *s, int owner, const Params *p);
+
+// Function to play pathToA's move for owner in the simulator: the position goes in as
+// the referee's input and the first action line comes back as a simulator move. A GROW
+// toward a cell that is not next to its parent takes the first step of a shortest path,
+// as the referee does; a SPORE, which the simulator does not model, counts as WAIT.
+static uint32_t path_to_a_move(const SimState *s, int owner, const Params *p) {
+    static GameState gameState;
+    static int16_t dist[GRID_CELLS];
+    char output[4096] = "";
+    const Grid *g = &s->grid;
+
+    sim_to_game_state(s, owner, &gameState);
+    path_to_a_use(p);
+    FILE *capture = fmemopen(output, sizeof(output) - 1, "w");
+    action_stream = capture;
+    decide_next_action(&gameState, s->turn);
+    fclose(capture);
+    action_stream = NULL;
+
+    int id, x, y;
+    char type[16], dir[4] = "N";
+    if (sscanf(output, "GROW %d %d %d %15s %3s", &id, &x, &y, type, dir) < 4 || x < 0 || x >= g->width || y < 0 ||
+        y >= g->height) {
+        return MOVE_WAIT;
+    }
+    int from = -1, to = grid_index(x, y), organ = ORGAN_TYPES;
+    for (int idx = 0; idx < GRID_CELLS && from < 0; idx++) {
+        if (piece_is_organ(g->piece[idx]) && piece_owner(g->piece[idx]) == owner && g->organ_id[idx] == id) {
+            from = idx;
+        }
+    }
+    for (int t = 0; t < ORGAN_TYPES; t++) {
+        organ = strcmp(type, organ_names[t]) == 0 ? t : organ;
+    }
+    const char *d = memchr(dir_chars, dir[0], sizeof(dir_chars));
+    if (from < 0 || organ == ORGAN_TYPES || d == NULL) {
+        return MOVE_WAIT;
+    }
+    grid_bfs(g, &to, 1, dist);
+    int step = -1;
+    for (int k = 0; k < 4; k++) {
+        int nb = grid_nb[from][k];
+        if (dist[nb] >= 0 && (step < 0 || dist[nb] < dist[step])) {
+            step = nb;
+        }
+    }
+    return step < 0 ? MOVE_WAIT : move_encode(from, step, organ, organ == ORGAN_BASIC ? 0 : (int)(d - dir_chars));
+}
+
+// The strategies the tuner can play in the simulator
+static const struct {
+    const Strategy *strategy;
+    TunerMove move;
+} tuner_players[] = {
+    {&strategy_path_to_a, path_to_a_move},
+    {&strategy_greedy, greedy_move},
+};
+
+static TunerMove tuner_move;
+
+/* ################################################################################# */
+
+/* #############  SELF-PLAY ################################################## */
+
+// Function to play one game, a as ME and b as OPP; returns +1 if a has more organs at
+// the end, -1 if fewer, 0 on a tie
+static int play_game(const SimState *start, const Params *a, const Params *b) {
+    SimState s = *start;
+    while (s.turn < TUNER_LAST_TURN) {
+        uint32_t mine = tuner_move(&s, ME, a);
+        uint32_t theirs = tuner_move(&s, OPP, b);
+        if (mine == MOVE_WAIT && theirs == MOVE_WAIT) {
+            break; // neither side can grow: only harvester income would change
+        }
+        sim_apply_joint(&s, mine, theirs);
+        sim_end_turn(&s);
+    }
+    int diff = s.organ_count[ME] - s.organ_count[OPP];
+    return (diff > 0) - (diff < 0);
+}
+
+// Function to play every map from both seats, split across forked workers; returns
+// the summed result from a's point of view, in [-2 * maps, 2 * maps]
+static int play_match(const MapSet *maps, const Params *a, const Params *b, int workers) {
+    int games = maps->count * 2;
+    int fds[TUNER_MAX_WORKERS][2];
+    workers = workers < games ? workers : games;
+
+    for (int w = 0; w < workers; w++) {
+        if (pipe(fds[w]) != 0) {
+            perror("pipe");
+            exit(1);
+        }
+        pid_t pid = fork();
+        if (pid == 0) {
+            int sum = 0;
+            if (freopen("/dev/null", "w", stderr) == NULL) { // the bots' per-turn logging
+                _exit(1);
+            }
+            for (int game = w; game < games; game += workers) {
+                const SimState *start = &maps->start[game / 2];
+                sum += (game & 1) ? -play_game(start, b, a) : play_game(start, a, b);
+            }
+            if (write(fds[w][1], &sum, sizeof(sum)) != sizeof(sum)) {
+                _exit(1);
+            }
+            _exit(0);
+        }
+        if (pid < 0) {
+            perror("fork");
+            exit(1);
+        }
+        close(fds[w][1]);
+    }
+
+    int total = 0;
+    for (int w = 0; w < workers; w++) {
+        int sum = 0;
+        if (read(fds[w][0], &sum, sizeof(sum)) == sizeof(sum)) {
+            total += sum;
+        }
+        close(fds[w][0]);
+    }
+    while (wait(NULL) > 0) {
+    }
+    return total;
+}
+
+/* ################################################################################# */
+
+/* #############  SPSA ####################################################### */
+
+// Function to map a point of the unit cube onto the parameter ranges
+static void params_from_unit(Params *p, const double *u) {
+    for (int i = 0; i < PARAM_COUNT; i++) {
+        double v = param_min[i] + u[i] * (param_max[i] - param_min[i]);
+        p->v[i] = param_clamp(i, (int)lround(v));
+    }
+}
+
+int main(int argc, char **argv) {
+    static MapSet maps;
+    int iterations = 200, map_count = 16, workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    const char *output = "boss1ParamsTuned.h";
+    const char *name = strategies[0]->name;
+
+    zobrist_init(1); // map files are loaded into simulator states while parsing
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            name = argv[++i];
+        } else if (strcmp(argv[i], "-i") == 0 && i + 1 < argc) {
+            iterations = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+            map_count = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            workers = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (maps.count < TUNER_MAX_MAPS) {
+            static GameState gameState;
+            if (!map_load_ascii(argv[i], &gameState)) {
+                return 1;
+            }
+            sim_load(&maps.start[maps.count++], &gameState);
+        }
+    }
+    workers = workers < 1 ? 1 : workers > TUNER_MAX_WORKERS ? TUNER_MAX_WORKERS : workers;
+    map_count = map_count < 1 ? 1 : map_count > TUNER_MAX_MAPS ? TUNER_MAX_MAPS : map_count;
+    for (int i = 0; i < (int)(sizeof(tuner_players) / sizeof(tuner_players[0])); i++) {
+        if (strcmp(tuner_players[i].strategy->name, name) == 0) {
+            tuner_move = tuner_players[i].move;
+        }
+    }
+    if (tuner_move == NULL) {
+        fprintf(stderr, "%s cannot be played in the simulator; tune pathToA or greedy\n", name);
+        return 1;
+    }
+    fprintf(stderr, "tuning %s\n", name);
+
+    bool generated = maps.count == 0;
+    Params theta, plus, minus, defaults;
+    params_default(&defaults);
+    double u[PARAM_COUNT], delta[PARAM_COUNT];
+    for (int i = 0; i < PARAM_COUNT; i++) {
+        u[i] = (double)(defaults.v[i] - param_min[i]) / (param_max[i] - param_min[i]);
+    }
+    params_from_unit(&theta, u);
+
+    // Standard SPSA gains: a_k = a / (k + 1 + A)^0.602, c_k = c / (k + 1)^0.101
+    const double a = 0.05, c = 0.08, stability = iterations * 0.1;
+    for (int k = 0; k < iterations; k++) {
+        if (generated) { // fresh maps every iteration so the vector cannot fit one set
+            maps.count = map_count;
+            for (int m = 0; m < maps.count; m++) {
+                random_map(&maps.start[m]);
+            }
+        }
+        double ak = a / pow(k + 1 + stability, 0.602), ck = c / pow(k + 1, 0.101);
+        double up[PARAM_COUNT], down[PARAM_COUNT];
+        for (int i = 0; i < PARAM_COUNT; i++) {
+            delta[i] = !param_read_by(i, name) ? 0.0 : (map_rand(&tuner_rng) & 1) ? 1.0 : -1.0;
+            up[i] = u[i] + ck * delta[i];
+            down[i] = u[i] - ck * delta[i];
+        }
+        params_from_unit(&plus, up);
+        params_from_unit(&minus, down);
+        double result = (double)play_match(&maps, &plus, &minus, workers) / (2 * maps.count);
+        for (int i = 0; i < PARAM_COUNT; i++) {
+            if (delta[i] == 0.0) {
+                continue; // read by another strategy
+            }
+            u[i] += ak * result / (2 * ck * delta[i]);
+            u[i] = u[i] < 0 ? 0 : u[i] > 1 ? 1 : u[i];
+        }
+        params_from_unit(&theta, u);
+        fprintf(stderr, "iteration %3d: theta+ scored %+.2f, ", k, result);
+        params_print(&theta, stderr);
+    }
+
+    // Final check against the compiled-in defaults on fresh maps
+    if (generated) {
+        for (int m = 0; m < maps.count; m++) {
+            random_map(&maps.start[m]);
+        }
+    }
+    int score = play_match(&maps, &theta, &defaults, workers);
+    char comment[128];
+    snprintf(comment, sizeof(comment), "%d iterations, %+d over %d games against the previous defaults",
+             iterations, score, 2 * maps.count);
+    printf("%s\n", comment);
+    params_print(&theta, stdout);
+    if (score < 0) {
+        printf("tuned vector lost to the defaults; %s not written\n", output);
+        return 0;
+    }
+    return params_write_header(&theta, output, comment) ? 0 : 1;
+}
+
+/* ################################################################################# */
@@ -0,0 +1,186 @@
+#ifndef BOSS1_ZOBRIST_H
+#define BOSS1_ZOBRIST_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "boss1Core.h"
+
+// Zobrist keys for the simulator state and a fixed-size transposition table.
+// Different GROW orders that reach the same grid hash to the same key, so a
+// search can look the position up instead of evaluating it again.
+
+#ifndef TT_DEFAULT_MB
+#define TT_DEFAULT_MB 64          // well below the 768 MB arena memory limit
+#endif
+#define TT_BUCKET_SIZE 4          // 4 x 16 byte entries = one 64 byte cache line
+
+/* #############  ZOBRIST KEYS ############################################### */
+
+typedef struct {
+    uint64_t piece[GRID_CELLS][PIECE_COUNT];
+    uint64_t protein[2][4];       // per owner, per protein type; mixed with the stock value
+    uint64_t side;                // xor-ed in when the opponent is to move
+} ZobristKeys;
+
+static ZobristKeys zobrist;
+
+// SplitMix64 step, used both to fill the key tables and to mix protein stocks
+static inline uint64_t zobrist_mix(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Function to fill the key tables; the seed is fixed so hashes are reproducible across runs
+void zobrist_init(uint64_t seed) {
+    uint64_t s = seed;
+    for (int c = 0; c < GRID_CELLS; c++) {
+        for (int p = 0; p < PIECE_COUNT; p++) {
+            zobrist.piece[c][p] = zobrist_mix(s++);
+        }
+        zobrist.piece[c][0] = 0; // empty cells do not contribute, so a blank grid hashes to 0
+    }
+    for (int o = 0; o < 2; o++) {
+        for (int t = 0; t < 4; t++) {
+            zobrist.protein[o][t] = zobrist_mix(s++);
+        }
+    }
+    zobrist.side = zobrist_mix(s++);
+}
+
+// Key contribution of a protein stock; stocks are unbounded so the value is mixed in
+// instead of indexing a table, and swapping the old term for the new one stays O(1)
+static inline uint64_t zobrist_protein_key(int owner, int type, int stock) {
+    return zobrist_mix(zobrist.protein[owner][type] + (uint64_t)stock);
+}
+
+/* ################################################################################# */
+
+/* #############  TRANSPOSITION TABLE ######################################## */
+
+#define TT_EXACT 0
+#define TT_LOWER 1
+#define TT_UPPER 2
+
+typedef struct {
+    uint64_t key;
+    uint32_t move;                // encoded best move, 0 if none
+    int16_t value;
+    int8_t depth;                 // remaining search depth the value was computed with
+    uint8_t gen_flag;             // generation in the high 6 bits, TT_* bound in the low 2
+} TTEntry;
+
+typedef struct {
+    TTEntry entry[TT_BUCKET_SIZE];
+} TTBucket;
+
+typedef struct {
+    TTBucket *buckets;
+    uint64_t mask;                // bucket_count - 1, bucket_count is a power of two
+    uint8_t generation;           // bumped once per turn so stale entries lose replacement ties
+    // instrumentation
+    uint64_t probes;
+    uint64_t hits;
+    uint64_t stores;
+    uint64_t overwrites;          // a store evicted a different live position
+} TransTable;
+
+// Function to allocate the table once; size_bytes is rounded down to a power of two buckets
+bool tt_init(TransTable *tt, size_t size_bytes) {
+    size_t count = 1;
+    while (count * 2 * sizeof(TTBucket) <= size_bytes) {
+        count *= 2;
+    }
+    memset(tt, 0, sizeof(*tt));
+    tt->buckets = calloc(count, sizeof(TTBucket));
+    if (tt->buckets == NULL) {
+        return false;
+    }
+    tt->mask = count - 1;
+    return true;
+}
+
+void tt_free(TransTable *tt) {
+    free(tt->buckets);
+    tt->buckets = NULL;
+}
+
+// Function to start a new search generation; entries from older turns become preferred victims
+void tt_new_generation(TransTable *tt) {
+    tt->generation = (uint8_t)((tt->generation + 1) & 63);
+}
+
+// Function to look up a key; returns the entry or NULL on a miss
+TTEntry *tt_probe(TransTable *tt, uint64_t key) {
+    TTBucket *bucket = &tt->buckets[key & tt->mask];
+    tt->probes++;
+    for (int i = 0; i < TT_BUCKET_SIZE; i++) {
+        if (bucket->entry[i].key == key) {
+            tt->hits++;
+            return &bucket->entry[i];
+        }
+    }
+    return NULL;
+}
+
+// Function to store a result: reuse the slot holding the same key, else evict the
+// shallowest entry, with entries from older generations counting as 8 plies shallower
+void tt_store(TransTable *tt, uint64_t key, int value, int depth, int flag, uint32_t move) {
+    TTBucket *bucket = &tt->buckets[key & tt->mask];
+    TTEntry *victim = &bucket->entry[0];
+    int victim_score = 1 << 30;
+
+    for (int i = 0; i < TT_BUCKET_SIZE; i++) {
+        TTEntry *e = &bucket->entry[i];
+        if (e->key == key) {
+            victim = e;
+            break;
+        }
+        int age = (tt->generation - (e->gen_flag >> 2)) & 63;
+        int score = e->key == 0 ? -(1 << 30) : e->depth - 8 * age;
+        if (score < victim_score) {
+            victim_score = score;
+            victim = e;
+        }
+    }
+
+    if (victim->key != 0 && victim->key != key) {
+        tt->overwrites++;
+    } else if (victim->key == key && victim->depth > depth && move == 0) {
+        return; // keep the deeper result for the same position
+    }
+    tt->stores++;
+    victim->key = key;
+    victim->value = (int16_t)value;
+    victim->depth = (int8_t)depth;
+    victim->move = move;
+    victim->gen_flag = (uint8_t)((tt->generation << 2) | (flag & 3));
+}
+
+// Function to print the table counters to stderr, once per turn or at the end of a run
+void tt_report(const TransTable *tt, FILE *out) {
+    uint64_t used = 0;
+    uint64_t sample = tt->mask + 1 < 1024 ? tt->mask + 1 : 1024;
+    for (uint64_t b = 0; b < sample; b++) {
+        for (int i = 0; i < TT_BUCKET_SIZE; i++) {
+            used += tt->buckets[b].entry[i].key != 0;
+        }
+    }
+    fprintf(out, "TT %llu KB: probes=%llu hits=%llu (%.1f%%) stores=%llu overwrites=%llu fill=%.1f%%\n",
+            (unsigned long long)((tt->mask + 1) * sizeof(TTBucket) / 1024),
+            (unsigned long long)tt->probes,
+            (unsigned long long)tt->hits,
+            tt->probes ? 100.0 * tt->hits / tt->probes : 0.0,
+            (unsigned long long)tt->stores,
+            (unsigned long long)tt->overwrites,
+            100.0 * used / (sample * TT_BUCKET_SIZE));
+}
+
+/* ################################################################################# */
+
+#endif
@@ -13,16 +13,18 @@ void readMapFromFile(const char *filename, char map[MAX_ROWS][MAX_COLS], int *ro
     }
 
     *rows = 0;
-    size_t len = 0;
-    while (fgets(map[*rows], MAX_COLS, file) != NULL) {
+    *cols = 0;
+    while (*rows < MAX_ROWS && fgets(map[*rows], MAX_COLS, file) != NULL) {
         // Remove newline character if present
         size_t len = strlen(map[*rows]);
         if (len > 0 && map[*rows][len - 1] == '\n') {
-            map[*rows][len - 1] = '\0';
+            map[*rows][--len] = '\0';
+        }
+        if ((int)len > *cols) {
+            *cols = (int)len; // Widest row; boss1Scenario.c turns a map into game input
         }
         (*rows)++;
     }
-    *cols = len; // Assuming all rows have the same number of columns
 
     fclose(file);
 }